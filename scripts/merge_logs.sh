@@ -0,0 +1,59 @@
+#!/bin/bash
+
+#
+# Merge the per-PE JSONL logs written with SHMEMVV_LOG_FORMAT=jsonl into one
+# time-ordered timeline on stdout.
+#
+# Usage: ./scripts/merge_logs.sh [--last] [--test <name>] [log_dir]
+#
+#   --last          Only print the last record of each PE, oldest first. When
+#                   a test hangs, the PEs at the top are the ones that stalled.
+#   --test <name>   Only merge the logs of the given test, e.g. c_shmem_put.c
+#   log_dir         (default=logs) Directory holding the <test>.peNN.jsonl logs
+#
+
+# --- Parse "time" values with a '.' decimal separator in any locale
+export LC_ALL=C
+
+LAST=0
+TEST="*"
+LOG_DIR=logs
+
+# --- Parse command line arguments
+while [[ $# -gt 0 ]]; do
+  case "$1" in
+  --last)
+    LAST=1
+    ;;
+  --test)
+    if [[ $# -lt 2 ]]; then
+      echo "Error: --test requires an argument" >&2
+      exit 1
+    fi
+    TEST=$2
+    shift
+    ;;
+  *)
+    LOG_DIR=$1
+    ;;
+  esac
+  shift
+done
+
+# --- Collect the per-PE logs
+logs=("$LOG_DIR"/$TEST.pe*.jsonl)
+if [ ! -f "${logs[0]}" ]; then
+  echo "Error: No JSONL logs found in $LOG_DIR" >&2
+  echo "Run the tests with SHMEMVV_LOG_FORMAT=jsonl to write them." >&2
+  exit 1
+fi
+
+# --- Every record starts with {"time":<seconds>, and each per-PE log is
+#     already in time order, so a merge on that field is enough
+if [ $LAST -eq 1 ]; then
+  for log in "${logs[@]}"; do
+    tail -n 1 "$log"
+  done | sort -s -t: -k2,2g
+else
+  sort -m -s -t: -k2,2g "${logs[@]}"
+fi
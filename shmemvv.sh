@@ -14,6 +14,12 @@ LAUNCHER_ARGS=""
 HLINE="================================================"
 ENABLE_C11=0 # By default, don't run C11 tests
 ENABLE_C=0   # By default, don't run C/C++ tests
+SINGLE_LAUNCH=0 # By default, launch each test executable separately
+RESIDENT=0      # By default, don't run test modules through shmemvv_runner
+SLOTS=0         # PE budget for concurrently running tests (0 = no budget)
+JOBS=0          # Maximum concurrently running tests (0 = no limit)
+BENCHMARKS=0    # By default, run the tests rather than the benchmarks
+BENCH_ARGS=""   # Extra arguments passed to every benchmark
 
 # --- PE counts for different test categories
 SETUP_NP=2
@@ -67,6 +73,13 @@ SETUP_BIN=$BIN_DIR/setup
 SIGNALING_BIN=$BIN_DIR/signaling
 TEAMS_BIN=$BIN_DIR/teams
 THREADS_BIN=$BIN_DIR/threads
+BENCH_DIR=$BIN_DIR/bench
+MODULE_DIR=$(pwd)/build/modules
+RUNNER=$BIN_DIR/shmemvv_runner
+
+# --- Test modules queued for the resident runner, and the PE count of each
+RESIDENT_MODULES=()
+RESIDENT_MODULE_NPS=()
 
 # --- Terminal colors
 if [ "$COLOR" -eq 1 ]; then
@@ -125,11 +138,17 @@ display_usage() {
   echo "  --launcher_args <args>  Add custom arguments to launcher"
   echo "  --enable_c11            Enable C11 tests (available for: atomics, collectives, pt2pt_sync, rma, signaling)"
   echo "  --enable_c              Enable C/C++ tests"
+  echo "  --single_launch         Run each category through its driver in one launcher invocation"
+  echo "  --resident              Run all selected test modules through shmemvv_runner, one launcher invocation per PE count"
+  echo "  --slots <N>             Run tests concurrently, using at most N PEs at a time"
+  echo "  --jobs <N>              Run at most N tests concurrently"
+  echo "  --benchmarks            Run the selected categories' benchmarks instead of their tests"
+  echo "  --bench_args <args>     Add custom arguments to every benchmark (e.g. \"-i 100 -M 1M\")"
   echo "  --verbose               Enable verbose output"
   echo "  --no-color              Disable colored output"
   echo "  --help                  Display this help message"
   echo ""
-  echo "Note: You must enable at least one of --enable_c or --enable_c11"
+  echo "Note: You must enable at least one of --enable_c or --enable_c11 (unless running --benchmarks)"
   echo ""
 }
 
@@ -140,6 +159,9 @@ setup_environment() {
   export SHMEMVV_LOG_DIR="$(pwd)/logs/"
   mkdir -p $SHMEMVV_LOG_DIR
 
+  # --- Collect per-routine timing records from every test in one file
+  export SHMEMVV_RESULTS_FILE="${SHMEMVV_LOG_DIR}results.jsonl"
+
   # --- Check for launcher
   if ! command -v $LAUNCHER &>/dev/null; then
     echo -e "${RED}Error: $LAUNCHER not found in PATH.${NC}"
@@ -178,19 +200,26 @@ setup_environment() {
   # echo -e "${GREEN}Found $test_count test executables. Test suite appears to be built correctly.${NC}"
 }
 
-# --- Run a single test
+# --- Run a single test: run_test <np> <executable> [<arg> ...]
 run_test() {
-  local test_path=$1
-  local test_name=$(basename $test_path)
-  local np=$2
+  local np=$1
+  shift
+  local test_name=$(basename "$1")
 
   if [ $VERBOSE -eq 1 ]; then
     echo -e "${BLUE}Running test:${NC} $test_name with $np PEs"
-    echo "Command: $LAUNCHER $LAUNCHER_ARGS -np $np $test_path"
+    echo "Command: $LAUNCHER $LAUNCHER_ARGS -np $np $*"
   fi
 
   # --- Run the test and capture output
-  local output=$($LAUNCHER $LAUNCHER_ARGS -np $np $test_path 2>&1)
+  local output=$($LAUNCHER $LAUNCHER_ARGS -np "$np" "$@" 2>&1)
+
+  report_test_output "$output"
+}
+
+# --- Count and display the output of a finished test
+report_test_output() {
+  local output=$1
 
   # --- Count passing and failing tests
   passing=$(echo "$output" | grep -o "PASSED" | wc -l)
@@ -204,6 +233,74 @@ run_test() {
   echo "$output"
 }
 
+# --- Number of tests using np PEs each that may run at the same time
+max_concurrent_tests() {
+  local np=$1
+  local max=0
+
+  if [ $SLOTS -gt 0 ]; then
+    max=$((SLOTS / np))
+    if [ $max -lt 1 ]; then
+      max=1
+    fi
+  fi
+
+  if [ $JOBS -gt 0 ] && { [ $max -eq 0 ] || [ $JOBS -lt $max ]; }; then
+    max=$JOBS
+  fi
+
+  if [ $max -eq 0 ]; then
+    max=1
+  fi
+
+  echo $max
+}
+
+# --- Launcher arguments that keep concurrent jobs off each other's cores.
+# Open MPI binds every job's PEs starting from the same cores, so unless the
+# user chose a binding, concurrent jobs are left unbound.
+concurrent_launcher_args() {
+  if [[ " $LAUNCHER_ARGS " == *" --bind-to "* ]]; then
+    return
+  fi
+  if $LAUNCHER --version 2>&1 | grep -q "Open MPI\|OpenRTE"; then
+    echo "--bind-to none"
+  fi
+}
+
+# --- Run tests concurrently, then report their output in launch order
+run_tests_concurrently() {
+  local np=$1
+  local max_jobs=$2
+  shift 2
+
+  local output_dir=$(mktemp -d)
+  local i=0
+  local bind_args=$(concurrent_launcher_args)
+
+  for executable in "$@"; do
+    # --- Wait until a running test frees its slots
+    while [ $(jobs -rp | wc -l) -ge $max_jobs ]; do
+      wait -n
+    done
+
+    if [ $VERBOSE -eq 1 ]; then
+      echo -e "${BLUE}Starting test:${NC} $(basename $executable) with $np PEs"
+      echo "Command: $LAUNCHER $LAUNCHER_ARGS $bind_args -np $np $executable"
+    fi
+
+    $LAUNCHER $LAUNCHER_ARGS $bind_args -np "$np" "$executable" >"$output_dir/$i.out" 2>&1 &
+    i=$((i + 1))
+  done
+  wait
+
+  for ((j = 0; j < i; j++)); do
+    report_test_output "$(cat "$output_dir/$j.out")"
+  done
+
+  rm -rf "$output_dir"
+}
+
 # --- Run all tests in a directory
 run_test_category() {
   local test_dir=$1
@@ -216,33 +313,137 @@ run_test_category() {
     return
   fi
 
+  # --- Queue the category's test modules for the resident runner
+  if [ $RESIDENT -eq 1 ]; then
+    local queued=0
+    for module in "$MODULE_DIR/$(basename "$test_dir")"/$pattern.so; do
+      if [ -f "$module" ]; then
+        queued=1
+        RESIDENT_MODULES+=("$module")
+        RESIDENT_MODULE_NPS+=("$np")
+      fi
+    done
+    if [ $queued -eq 1 ]; then
+      return
+    fi
+    echo -e "${YELLOW}Warning: No test modules found for $category_name, launching tests individually.${NC}"
+  fi
+
   echo "$HLINE"
   echo -e "${BOLD}Running $category_name tests (${np} PEs)...${NC}"
   echo "$HLINE"
 
+  # --- Run the whole category under one shmem_init() if a driver was built
+  if [ $SINGLE_LAUNCH -eq 1 ]; then
+    local driver="$test_dir/shmemvv_driver_${pattern%%_*}_$(basename $test_dir)"
+    if [ -x "$driver" ]; then
+      run_test "$np" "$driver"
+      echo ""
+      return
+    fi
+    echo -e "${YELLOW}Warning: No category driver found for $category_name, launching tests individually.${NC}"
+  fi
+
   # --- Check if any executables matching the pattern exist
-  local found_tests=0
-  for executable in $test_dir/$pattern; do
+  local executables=()
+  for executable in "$test_dir"/$pattern; do
     if [ -x "$executable" ]; then
-      found_tests=1
-      run_test "$executable" "$np"
+      executables+=("$executable")
     fi
   done
 
+  local max_jobs=$(max_concurrent_tests "$np")
+  if [ $max_jobs -gt 1 ] && [ ${#executables[@]} -gt 1 ]; then
+    run_tests_concurrently "$np" "$max_jobs" "${executables[@]}"
+  else
+    for executable in "${executables[@]}"; do
+      run_test "$np" "$executable"
+    done
+  fi
+
   # --- Display message if no tests were found
-  if [ $found_tests -eq 0 ]; then
+  if [ ${#executables[@]} -eq 0 ]; then
     echo -e "${YELLOW}No compiled tests found for $category_name. Make sure to build these tests first.${NC}"
   fi
 
   echo ""
 }
 
+# --- Run all benchmarks in a directory, one at a time
+run_benchmark_category() {
+  local bench_dir=$1
+  local category_name=$2
+  local np=$3
+
+  # --- Not every category has benchmarks
+  if [ ! -d "$bench_dir" ]; then
+    return
+  fi
+
+  echo "$HLINE"
+  echo -e "${BOLD}Running $category_name benchmarks (${np} PEs)...${NC}"
+  echo "$HLINE"
+
+  for executable in $bench_dir/bench_*; do
+    if [ -x "$executable" ]; then
+      if [ $VERBOSE -eq 1 ]; then
+        echo -e "${BLUE}Running benchmark:${NC} $(basename $executable) with $np PEs"
+        echo "Command: $LAUNCHER $LAUNCHER_ARGS -np $np $executable $BENCH_ARGS"
+      fi
+      $LAUNCHER $LAUNCHER_ARGS -np $np $executable $BENCH_ARGS 2>&1
+      echo ""
+    fi
+  done
+}
+
+# --- Run the queued test modules in one shmemvv_runner job per PE count
+run_resident_modules() {
+  if [ ${#RESIDENT_MODULES[@]} -eq 0 ]; then
+    return
+  fi
+
+  if [ ! -x "$RUNNER" ]; then
+    echo -e "${RED}Error: $RUNNER not found. Configure with -DENABLE_TEST_MODULES=ON.${NC}"
+    exit 1
+  fi
+
+  # --- PE counts in the order their categories were queued
+  local nps=()
+  for np in "${RESIDENT_MODULE_NPS[@]}"; do
+    if [[ " ${nps[*]} " != *" $np "* ]]; then
+      nps+=("$np")
+    fi
+  done
+
+  for np in "${nps[@]}"; do
+    local cmd=("$RUNNER")
+    for i in "${!RESIDENT_MODULES[@]}"; do
+      if [ "${RESIDENT_MODULE_NPS[$i]}" -eq "$np" ]; then
+        cmd+=("${RESIDENT_MODULES[$i]}")
+      fi
+    done
+
+    echo "$HLINE"
+    echo -e "${BOLD}Running $((${#cmd[@]} - 1)) test modules (${np} PEs)...${NC}"
+    echo "$HLINE"
+
+    run_test "$np" "${cmd[@]}"
+    echo ""
+  done
+}
+
 # --- Run C and C11 tests for a category
 run_all_langs() {
   local dir=$1
   local name=$2
   local np=$3
 
+  # --- Run the category's benchmarks instead if requested
+  if [ $BENCHMARKS -eq 1 ]; then
+    run_benchmark_category "$BENCH_DIR/$(basename $dir)" "$name" "$np"
+    return
+  fi
+
   # --- Run C tests if enabled
   if [ $ENABLE_C -eq 1 ]; then
     run_test_category "$dir" "$name (C/C++)" "$np" "c_*"
@@ -260,6 +461,12 @@ run_c_only() {
   local name=$2
   local np=$3
 
+  # --- Run the category's benchmarks instead if requested
+  if [ $BENCHMARKS -eq 1 ]; then
+    run_benchmark_category "$BENCH_DIR/$(basename $dir)" "$name" "$np"
+    return
+  fi
+
   # --- Run C tests if enabled
   if [ $ENABLE_C -eq 1 ]; then
     run_test_category "$dir" "$name (C/C++)" "$np" "c_*"
@@ -383,6 +590,9 @@ print_summary() {
   # Print logs directory location
   echo -e "${BOLD}Test logs are available in:${NC} ${YELLOW}$SHMEMVV_LOG_DIR${NC}"
   echo -e "For detailed test results, check the log files in this directory."
+  if [ -f "$SHMEMVV_RESULTS_FILE" ]; then
+    echo -e "${BOLD}Per-routine timings are available in:${NC} ${YELLOW}$SHMEMVV_RESULTS_FILE${NC}"
+  fi
   echo ""
 }
 
@@ -417,6 +627,39 @@ parse_args() {
     --enable_c)
       ENABLE_C=1
       ;;
+    --single_launch)
+      SINGLE_LAUNCH=1
+      ;;
+    --resident)
+      RESIDENT=1
+      ;;
+    --benchmarks)
+      BENCHMARKS=1
+      ;;
+    --bench_args)
+      if [[ $# -lt 2 ]]; then
+        echo -e "${RED}Error: --bench_args requires an argument${NC}"
+        exit 1
+      fi
+      BENCH_ARGS=$2
+      shift
+      ;;
+    --slots | --jobs)
+      if [[ $# -lt 2 ]]; then
+        echo -e "${RED}Error: $1 requires a numeric argument${NC}"
+        exit 1
+      fi
+      if ! [[ $2 =~ ^[0-9]+$ ]]; then
+        echo -e "${RED}Error: $1 argument must be a number${NC}"
+        exit 1
+      fi
+      if [ "$1" = "--slots" ]; then
+        SLOTS=$2
+      else
+        JOBS=$2
+      fi
+      shift
+      ;;
     --test_setup)
       RUN_SETUP=1
       RUN_ALL=0
@@ -553,7 +796,7 @@ main() {
   apply_np_override
 
   # Check if at least one language is enabled
-  if [ $ENABLE_C -eq 0 ] && [ $ENABLE_C11 -eq 0 ]; then
+  if [ $BENCHMARKS -eq 0 ] && [ $ENABLE_C -eq 0 ] && [ $ENABLE_C11 -eq 0 ]; then
     echo -e "${RED}Error: You must enable at least one test language using --enable_c or --enable_c11${NC}"
     display_usage
     exit 1
@@ -583,7 +826,13 @@ main() {
     [ $RUN_LOCKING -eq 1 ] && run_locking_tests
   fi
 
-  print_summary
+  if [ $RESIDENT -eq 1 ]; then
+    run_resident_modules
+  fi
+
+  if [ $BENCHMARKS -eq 0 ]; then
+    print_summary
+  fi
 }
 
 # Execute main with all arguments
@@ -0,0 +1,266 @@
+/**
+ * @file bench.c
+ * @brief Option parsing, timing, statistics and output helpers shared by
+ *        the performance benchmarks.
+ */
+
+#include <errno.h>
+#include <getopt.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "bench.h"
+
+/**
+ * @brief Parses a size in bytes with an optional K, M or G suffix.
+ *
+ * @param arg Option argument to parse.
+ * @param size Parsed size.
+ * @return True if `arg` is a valid, non-zero size that fits in a size_t.
+ */
+static bool parse_size(const char *arg, size_t *size) {
+  char *end;
+  int shift = 0;
+
+  /* strtoull() accepts and negates a leading '-' */
+  errno = 0;
+  unsigned long long value = strtoull(arg, &end, 10);
+  if (end == arg || errno == ERANGE || strchr(arg, '-') != NULL) {
+    return false;
+  }
+
+  switch (*end) {
+  case 'k':
+  case 'K':
+    shift = 10;
+    end++;
+    break;
+  case 'm':
+  case 'M':
+    shift = 20;
+    end++;
+    break;
+  case 'g':
+  case 'G':
+    shift = 30;
+    end++;
+    break;
+  }
+
+  if (*end != '\0' || value == 0 || value > (SIZE_MAX >> shift)) {
+    return false;
+  }
+
+  *size = (size_t)value << shift;
+  return true;
+}
+
+/**
+ * @brief Parses a positive integer option.
+ *
+ * @param arg Option argument to parse.
+ * @param value Parsed value.
+ * @param allow_zero True if zero is a valid value.
+ * @return True if `arg` is a valid integer in range.
+ */
+static bool parse_int(const char *arg, int *value, bool allow_zero) {
+  char *end;
+  long parsed = strtol(arg, &end, 10);
+
+  *value = (int)parsed;
+  return end != arg && *end == '\0' && parsed >= (allow_zero ? 0 : 1) &&
+         parsed <= 1 << 30;
+}
+
+/**
+ * @brief Parses a positive duration in seconds.
+ *
+ * @param arg Option argument to parse.
+ * @param seconds Parsed duration.
+ * @return True if `arg` is a number of seconds above zero and at most an
+ *         hour.
+ */
+static bool parse_seconds(const char *arg, double *seconds) {
+  char *end;
+  double parsed = strtod(arg, &end);
+
+  if (end == arg || *end != '\0' || !isfinite(parsed) || parsed <= 0.0 ||
+      parsed > 3600.0) {
+    return false;
+  }
+
+  *seconds = parsed;
+  return true;
+}
+
+/**
+ * @brief Parses the common benchmark options.
+ *
+ * Options are -i iterations, -w warmup iterations, -m and -M the smallest
+ * and largest message size (with an optional K, M or G suffix), -W the
+ * largest window of outstanding operations, -t the largest number of
+ * threads per PE and -d the seconds each time-limited measurement runs.
+ * Benchmarks ignore the options that do not apply to them.
+ *
+ * @param argc Argument count passed to main().
+ * @param argv Arguments passed to main().
+ * @param opts Defaults on entry, parsed options on return.
+ * @return True if the options are valid; on false, PE 0 has printed usage.
+ */
+bool bench_parse_args(int argc, char *argv[], bench_options_t *opts) {
+  bool valid = true;
+  int opt;
+
+  while (valid && (opt = getopt(argc, argv, "i:w:m:M:W:t:d:h")) != -1) {
+    switch (opt) {
+    case 'i':
+      valid = parse_int(optarg, &opts->iterations, false);
+      break;
+    case 'w':
+      valid = parse_int(optarg, &opts->warmup, true);
+      break;
+    case 'm':
+      valid = parse_size(optarg, &opts->min_size);
+      break;
+    case 'M':
+      valid = parse_size(optarg, &opts->max_size);
+      break;
+    case 'W':
+      valid = parse_int(optarg, &opts->max_window, false);
+      break;
+    case 't':
+      valid = parse_int(optarg, &opts->max_threads, false);
+      break;
+    case 'd':
+      valid = parse_seconds(optarg, &opts->duration);
+      break;
+    default:
+      valid = false;
+      break;
+    }
+  }
+
+  if (valid && opts->min_size > opts->max_size) {
+    valid = false;
+  }
+
+  if (!valid && shmem_my_pe() == 0) {
+    fprintf(stderr,
+            "Usage: %s [-i iterations] [-w warmup] [-m min_size] "
+            "[-M max_size] [-W max_window] [-t max_threads] "
+            "[-d seconds]\n",
+            argv[0]);
+  }
+
+  return valid;
+}
+
+/**
+ * @brief Current time of the monotonic clock.
+ *
+ * @return Time in seconds.
+ */
+double bench_time(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Orders doubles for qsort().
+ */
+static int compare_doubles(const void *a, const void *b) {
+  double x = *(const double *)a;
+  double y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+/**
+ * @brief Summarizes timed samples.
+ *
+ * @param samples Samples in seconds; sorted in place.
+ * @param count Number of samples.
+ * @param stats Summary of the samples.
+ */
+void bench_compute_stats(double *samples, int count, bench_stats_t *stats) {
+  double sum = 0.0;
+
+  qsort(samples, count, sizeof(double), compare_doubles);
+  for (int i = 0; i < count; i++) {
+    sum += samples[i];
+  }
+
+  stats->min = samples[0];
+  stats->median = samples[count / 2];
+  stats->p99 = samples[(int)(0.99 * (count - 1))];
+  stats->max = samples[count - 1];
+  stats->mean = sum / count;
+}
+
+/**
+ * @brief Sums a value over all PEs. Every PE must call this function.
+ *
+ * @param value This PE's value.
+ * @return Sum of the values of all PEs.
+ */
+double bench_sum_across_pes(double value) {
+  static double source, sum;
+
+  source = value;
+  shmem_double_sum_reduce(SHMEM_TEAM_WORLD, &sum, &source, 1);
+  return sum;
+}
+
+/**
+ * @brief Largest value over all PEs. Every PE must call this function.
+ *
+ * @param value This PE's value.
+ * @return Largest of the values of all PEs.
+ */
+double bench_max_across_pes(double value) {
+  static double source, max;
+
+  source = value;
+  shmem_double_max_reduce(SHMEM_TEAM_WORLD, &max, &source, 1);
+  return max;
+}
+
+/**
+ * @brief Prints a benchmark's `#` header lines on PE 0.
+ *
+ * @param title Name of the benchmark.
+ * @param opts Options the benchmark runs with.
+ * @param columns Column names of the rows that follow.
+ */
+void bench_print_header(const char *title, const bench_options_t *opts,
+                        const char *columns) {
+  if (shmem_my_pe() != 0) {
+    return;
+  }
+
+  printf("# %s\n", title);
+  printf("# PEs: %d, iterations: %d, warmup: %d\n", shmem_n_pes(),
+         opts->iterations, opts->warmup);
+  printf("# %s\n", columns);
+}
+
+/**
+ * @brief Prints a latency row on PE 0.
+ *
+ * @param routine Name of the timed routine.
+ * @param bytes Message size in bytes.
+ * @param stats Summary of the timed samples.
+ */
+void bench_print_latency(const char *routine, size_t bytes,
+                         const bench_stats_t *stats) {
+  if (shmem_my_pe() != 0) {
+    return;
+  }
+
+  printf("%-36s %10zu %12.3f %12.3f\n", routine, bytes, stats->median * 1e6,
+         stats->p99 * 1e6);
+}
@@ -0,0 +1,99 @@
+/**
+ * @file bench_atomics_nbi_pipelining.c
+ * @brief Pipelining benchmark for non-blocking fetching atomics.
+ *
+ * Every PE times batches of N fetch-and-adds spread round-robin over all
+ * other PEs, issued either as N blocking shmem_long_atomic_fetch_add()
+ * calls or as N shmem_long_atomic_fetch_add_nbi() calls completed by one
+ * shmem_quiet(). Batch sizes double from 1 to -W. A speedup close to 1 at
+ * large batches means the implementation serializes the non-blocking
+ * atomics instead of overlapping them.
+ */
+
+#include <shmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+  opts.max_window = 256;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("ATOMICS");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  /* Every PE adds into its own word on each target */
+  long *counters = shmem_calloc(npes, sizeof(long));
+  long *fetched = malloc(opts.max_window * sizeof(long));
+  int *targets = malloc(opts.max_window * sizeof(int));
+  double *samples = malloc(opts.iterations * sizeof(double));
+  if (counters == NULL || fetched == NULL || targets == NULL ||
+      samples == NULL) {
+    if (mype == 0) {
+      fprintf(stderr, "Could not allocate a batch of %d operations\n",
+              opts.max_window);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+
+  for (int i = 0; i < opts.max_window; i++) {
+    targets[i] = (mype + 1 + i % (npes - 1)) % npes;
+  }
+
+  long *dest = &counters[mype];
+  bench_stats_t blocking, nbi;
+
+  bench_print_header("Non-blocking fetching AMO pipelining", &opts,
+                     "batch blocking_us nbi_us nbi_speedup");
+
+  for (int batch = 1; batch <= opts.max_window; batch *= 2) {
+    shmem_barrier_all();
+    BENCH_TIME_SAMPLES(samples, blocking, opts, {
+      for (int i = 0; i < batch; i++) {
+        fetched[i] = shmem_long_atomic_fetch_add(dest, 1, targets[i]);
+      }
+    });
+
+    shmem_barrier_all();
+    BENCH_TIME_SAMPLES(samples, nbi, opts, {
+      for (int i = 0; i < batch; i++) {
+        shmem_long_atomic_fetch_add_nbi(&fetched[i], dest, 1, targets[i]);
+      }
+      shmem_quiet();
+    });
+
+    /* Average the per-PE medians so that every PE's view counts */
+    double blocking_us = bench_sum_across_pes(blocking.median) / npes * 1e6;
+    double nbi_us = bench_sum_across_pes(nbi.median) / npes * 1e6;
+    if (mype == 0) {
+      printf("%6d %14.3f %14.3f %12.2f\n", batch, blocking_us, nbi_us,
+             blocking_us / nbi_us);
+    }
+  }
+
+  shmem_barrier_all();
+
+  free(samples);
+  free(targets);
+  free(fetched);
+  shmem_free(counters);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file bench_atomics_throughput.c
+ * @brief AMO throughput benchmark under three contention patterns.
+ *
+ * Every PE issues windows of -W atomics, each followed by shmem_quiet() for
+ * the non-fetching operations, against:
+ *   - hot:      one word on PE 0 shared by all PEs,
+ *   - distinct: a word of its own on PE 0,
+ *   - random:   a word of its own on uniformly random PEs.
+ * Every operation of SHMEM_STANDARD_AMO_TYPE_TABLE,
+ * SHMEM_EXTENDED_AMO_TYPE_TABLE and SHMEM_BITWISE_AMO_TYPE_TABLE is
+ * covered. Results are aggregate operations per second over all PEs and the
+ * mean time per operation on PE 0.
+ */
+
+#include <shmem.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+#include "type_tables.h"
+
+typedef enum {
+  BENCH_PATTERN_HOT,
+  BENCH_PATTERN_DISTINCT,
+  BENCH_PATTERN_RANDOM,
+  BENCH_NUM_PATTERNS
+} bench_pattern_t;
+
+static const char *pattern_names[BENCH_NUM_PATTERNS] = {"hot", "distinct",
+                                                        "random"};
+
+/* Times OP_STMT against `dest` on PE `target` under each pattern */
+#define BENCH_AMO_THROUGHPUT(ROUTINE, TYPE, OP_STMT, COMPLETE_STMT)            \
+  do {                                                                         \
+    for (int pattern = 0; pattern < BENCH_NUM_PATTERNS; pattern++) {           \
+      TYPE *dest = (TYPE *)remote + (pattern == BENCH_PATTERN_HOT ? 0 : mype); \
+      const int *targets =                                                     \
+          pattern == BENCH_PATTERN_RANDOM ? random_targets : pe0_targets;      \
+                                                                               \
+      shmem_barrier_all();                                                     \
+      BENCH_TIME_SAMPLES(samples, stats, opts, {                               \
+        for (int w = 0; w < opts.max_window; w++) {                            \
+          int target = targets[w];                                             \
+          OP_STMT;                                                             \
+        }                                                                      \
+        COMPLETE_STMT;                                                         \
+      });                                                                      \
+                                                                               \
+      double rate = bench_sum_across_pes(opts.max_window / stats.mean);        \
+      if (mype == 0) {                                                         \
+        printf("%-36s %9s %16.3f %12.3f\n", ROUTINE, pattern_names[pattern],   \
+               rate / 1e6, stats.mean / opts.max_window * 1e6);                \
+      }                                                                        \
+    }                                                                          \
+  } while (0)
+
+#define BENCH_STANDARD_AMO(TYPE, TYPENAME)                                     \
+  do {                                                                         \
+    TYPE value = 1, fetched = 0;                                               \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_fetch_inc", TYPE,         \
+                         fetched = shmem_##TYPENAME##_atomic_fetch_inc(        \
+                             dest, target),                                    \
+                         (void)fetched);                                       \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_inc", TYPE,               \
+                         shmem_##TYPENAME##_atomic_inc(dest, target),          \
+                         shmem_quiet());                                       \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_fetch_add", TYPE,         \
+                         fetched = shmem_##TYPENAME##_atomic_fetch_add(        \
+                             dest, value, target),                             \
+                         (void)fetched);                                       \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_add", TYPE,               \
+                         shmem_##TYPENAME##_atomic_add(dest, value, target),   \
+                         shmem_quiet());                                       \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_compare_swap", TYPE,      \
+                         fetched = shmem_##TYPENAME##_atomic_compare_swap(     \
+                             dest, fetched, value, target),                    \
+                         (void)fetched);                                       \
+  } while (0)
+
+#define BENCH_EXTENDED_AMO(TYPE, TYPENAME)                                     \
+  do {                                                                         \
+    TYPE value = 1, fetched = 0;                                               \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_fetch", TYPE,             \
+                         fetched = shmem_##TYPENAME##_atomic_fetch(dest,       \
+                                                                   target),    \
+                         (void)fetched);                                       \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_set", TYPE,               \
+                         shmem_##TYPENAME##_atomic_set(dest, value, target),   \
+                         shmem_quiet());                                       \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_swap", TYPE,              \
+                         fetched = shmem_##TYPENAME##_atomic_swap(dest, value, \
+                                                                  target),     \
+                         (void)fetched);                                       \
+  } while (0)
+
+#define BENCH_BITWISE_AMO(TYPE, TYPENAME)                                      \
+  do {                                                                         \
+    TYPE value = 1, fetched = 0;                                               \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_fetch_and", TYPE,         \
+                         fetched = shmem_##TYPENAME##_atomic_fetch_and(        \
+                             dest, value, target),                             \
+                         (void)fetched);                                       \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_and", TYPE,               \
+                         shmem_##TYPENAME##_atomic_and(dest, value, target),   \
+                         shmem_quiet());                                       \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_fetch_or", TYPE,          \
+                         fetched = shmem_##TYPENAME##_atomic_fetch_or(         \
+                             dest, value, target),                             \
+                         (void)fetched);                                       \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_or", TYPE,                \
+                         shmem_##TYPENAME##_atomic_or(dest, value, target),    \
+                         shmem_quiet());                                       \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_fetch_xor", TYPE,         \
+                         fetched = shmem_##TYPENAME##_atomic_fetch_xor(        \
+                             dest, value, target),                             \
+                         (void)fetched);                                       \
+    BENCH_AMO_THROUGHPUT("shmem_" #TYPENAME "_atomic_xor", TYPE,               \
+                         shmem_##TYPENAME##_atomic_xor(dest, value, target),   \
+                         shmem_quiet());                                       \
+  } while (0)
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+  opts.iterations = 100;
+  opts.warmup = 10;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("ATOMICS");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  /* One word per PE, wide enough for every AMO type */
+  uint64_t *remote = shmem_calloc(npes, sizeof(uint64_t));
+  int *pe0_targets = calloc(opts.max_window, sizeof(int));
+  int *random_targets = malloc(opts.max_window * sizeof(int));
+  double *samples = malloc(opts.iterations * sizeof(double));
+  if (remote == NULL || pe0_targets == NULL || random_targets == NULL ||
+      samples == NULL) {
+    if (mype == 0) {
+      fprintf(stderr, "Could not allocate a window of %d targets\n",
+              opts.max_window);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+
+  srand(mype + 1);
+  for (int w = 0; w < opts.max_window; w++) {
+    random_targets[w] = rand() % npes;
+  }
+
+  bench_stats_t stats;
+
+  bench_print_header("AMO throughput", &opts,
+                     "routine pattern aggregate_Mops_per_s us_per_op");
+  if (mype == 0) {
+    printf("# operations per sample: %d\n", opts.max_window);
+  }
+
+#define X(type, shmem_types) BENCH_STANDARD_AMO(type, shmem_types);
+  SHMEM_STANDARD_AMO_TYPE_TABLE(X)
+#undef X
+
+#define X(type, shmem_types) BENCH_EXTENDED_AMO(type, shmem_types);
+  SHMEM_EXTENDED_AMO_TYPE_TABLE(X)
+#undef X
+
+#define X(type, shmem_types) BENCH_BITWISE_AMO(type, shmem_types);
+  SHMEM_BITWISE_AMO_TYPE_TABLE(X)
+#undef X
+
+  shmem_barrier_all();
+
+  free(samples);
+  free(random_targets);
+  free(pe0_targets);
+  shmem_free(remote);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,183 @@
+/**
+ * @file bench_collectives_scaling.c
+ * @brief Collective operation scaling benchmark.
+ *
+ * Times shmem_broadcastmem, shmem_collectmem, shmem_fcollectmem,
+ * shmem_alltoallmem, shmem_alltoallsmem (stride 2) and
+ * shmem_long_sum_reduce back to back, for per-PE message sizes from -m to
+ * -M bytes, on SHMEM_TEAM_WORLD and on two teams split from it: the even
+ * PEs (shmem_team_split_strided with stride 2) and the first half of the
+ * PEs. The reported latency is the largest median over the team's PEs.
+ * Algorithmic bandwidth is the data each PE ends up with (the message for
+ * broadcast and reduce, the message times the team size for the others)
+ * divided by that latency.
+ */
+
+#include <shmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+#define BENCH_ALLTOALLS_STRIDE 2
+
+typedef enum {
+  BENCH_BROADCAST,
+  BENCH_COLLECT,
+  BENCH_FCOLLECT,
+  BENCH_ALLTOALL,
+  BENCH_ALLTOALLS,
+  BENCH_REDUCE,
+  BENCH_NUM_COLLECTIVES
+} bench_collective_t;
+
+static const char *collective_names[BENCH_NUM_COLLECTIVES] = {
+    "shmem_broadcastmem", "shmem_collectmem",   "shmem_fcollectmem",
+    "shmem_alltoallmem",  "shmem_alltoallsmem", "shmem_long_sum_reduce"};
+
+static char *dest;
+static char *source;
+
+/**
+ * @brief Runs one collective on a team.
+ *
+ * @param collective Collective to run.
+ * @param team Team to run it on.
+ * @param size Message size per PE in bytes.
+ */
+static void run_collective(bench_collective_t collective, shmem_team_t team,
+                           size_t size) {
+  switch (collective) {
+  case BENCH_BROADCAST:
+    shmem_broadcastmem(team, dest, source, size, 0);
+    break;
+  case BENCH_COLLECT:
+    shmem_collectmem(team, dest, source, size);
+    break;
+  case BENCH_FCOLLECT:
+    shmem_fcollectmem(team, dest, source, size);
+    break;
+  case BENCH_ALLTOALL:
+    shmem_alltoallmem(team, dest, source, size);
+    break;
+  case BENCH_ALLTOALLS:
+    shmem_alltoallsmem(team, dest, source, BENCH_ALLTOALLS_STRIDE,
+                       BENCH_ALLTOALLS_STRIDE, size);
+    break;
+  default:
+    shmem_long_sum_reduce(team, (long *)dest, (const long *)source,
+                          size / sizeof(long));
+    break;
+  }
+}
+
+/**
+ * @brief Bytes each PE of the team ends up with after a collective.
+ */
+static size_t result_bytes(bench_collective_t collective, int team_npes,
+                           size_t size) {
+  switch (collective) {
+  case BENCH_BROADCAST:
+  case BENCH_REDUCE:
+    return size;
+  default:
+    return size * team_npes;
+  }
+}
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+  opts.iterations = 100;
+  opts.warmup = 10;
+  opts.max_size = 1024 * 1024;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("COLLECTIVES");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  /* Large enough for every PE's block of a strided all-to-all */
+  size_t buffer_size = opts.max_size * npes * BENCH_ALLTOALLS_STRIDE;
+  dest = shmem_malloc(buffer_size);
+  source = shmem_malloc(buffer_size);
+  double *samples = malloc(opts.iterations * sizeof(double));
+  if (dest == NULL || source == NULL || samples == NULL) {
+    if (mype == 0) {
+      fprintf(stderr,
+              "Could not allocate %zu byte symmetric buffers; lower -M or "
+              "raise SHMEM_SYMMETRIC_SIZE\n",
+              buffer_size);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+  memset(source, 1, buffer_size);
+
+  shmem_team_t teams[3] = {SHMEM_TEAM_WORLD, SHMEM_TEAM_INVALID,
+                           SHMEM_TEAM_INVALID};
+  const char *team_names[3] = {"world", "even", "half"};
+  int team_npes[3] = {npes, (npes + 1) / 2, npes / 2};
+  shmem_team_split_strided(SHMEM_TEAM_WORLD, 0, 2, team_npes[1], NULL, 0,
+                           &teams[1]);
+  shmem_team_split_strided(SHMEM_TEAM_WORLD, 0, 1, team_npes[2], NULL, 0,
+                           &teams[2]);
+
+  bench_stats_t stats;
+
+  bench_print_header("Collectives scaling", &opts,
+                     "routine team team_pes bytes median_us algbw_MB_per_s");
+
+  for (int t = 0; t < 3; t++) {
+    bool member = teams[t] != SHMEM_TEAM_INVALID;
+
+    for (int c = 0; c < BENCH_NUM_COLLECTIVES; c++) {
+      for (size_t size = opts.min_size; size <= opts.max_size; size *= 2) {
+        if (c == BENCH_REDUCE && size < sizeof(long)) {
+          continue;
+        }
+
+        double median = 0.0;
+        shmem_barrier_all();
+        if (member) {
+          BENCH_TIME_SAMPLES(samples, stats, opts,
+                             run_collective(c, teams[t], size));
+          median = stats.median;
+        }
+
+        double latency = bench_max_across_pes(median);
+        if (mype == 0) {
+          printf("%-24s %6s %8d %10zu %12.3f %14.2f\n", collective_names[c],
+                 team_names[t], team_npes[t], size, latency * 1e6,
+                 result_bytes(c, team_npes[t], size) / latency / 1e6);
+        }
+      }
+    }
+  }
+
+  shmem_barrier_all();
+
+  for (int t = 1; t < 3; t++) {
+    if (teams[t] != SHMEM_TEAM_INVALID) {
+      shmem_team_destroy(teams[t]);
+    }
+  }
+  free(samples);
+  shmem_free(source);
+  shmem_free(dest);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file bench_collectives_sync.c
+ * @brief Barrier and sync latency benchmark.
+ *
+ * Times shmem_barrier_all, shmem_sync_all and shmem_team_sync on
+ * SHMEM_TEAM_WORLD, on the even PEs (shmem_team_split_strided with stride
+ * 2), and on the row and column teams of a near-square grid from
+ * shmem_team_split_2d. Each measurement starts with an untimed calibration
+ * sync, then times each of a run of back-to-back syncs on its own: every
+ * sync after the first starts with the team already aligned by the one
+ * before it, so arrival skew between PEs stays out of the samples. The
+ * reported median and p99 are the largest over the team's PEs.
+ */
+
+#include <shmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+#define BENCH_NUM_TEAMS 4
+
+typedef enum {
+  BENCH_BARRIER_ALL,
+  BENCH_SYNC_ALL,
+  BENCH_TEAM_SYNC
+} bench_sync_t;
+
+/**
+ * @brief Runs one sync of the given kind.
+ */
+static void run_sync(bench_sync_t kind, shmem_team_t team) {
+  switch (kind) {
+  case BENCH_BARRIER_ALL:
+    shmem_barrier_all();
+    break;
+  case BENCH_SYNC_ALL:
+    shmem_sync_all();
+    break;
+  default:
+    shmem_team_sync(team);
+    break;
+  }
+}
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("COLLECTIVES");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  double *samples = malloc(opts.iterations * sizeof(double));
+  if (samples == NULL) {
+    shmem_global_exit(EXIT_FAILURE);
+  }
+
+  /* Rows of a grid that is as close to square as npes allows */
+  int xrange = 1;
+  while (xrange * xrange < npes) {
+    xrange++;
+  }
+
+  shmem_team_t teams[BENCH_NUM_TEAMS] = {SHMEM_TEAM_WORLD, SHMEM_TEAM_INVALID,
+                                         SHMEM_TEAM_INVALID,
+                                         SHMEM_TEAM_INVALID};
+  const char *team_names[BENCH_NUM_TEAMS] = {"world", "even", "row",
+                                             "column"};
+  shmem_team_split_strided(SHMEM_TEAM_WORLD, 0, 2, (npes + 1) / 2, NULL, 0,
+                           &teams[1]);
+  shmem_team_split_2d(SHMEM_TEAM_WORLD, xrange, NULL, 0, &teams[2], NULL, 0,
+                      &teams[3]);
+
+  bench_stats_t stats;
+
+  bench_print_header("Barrier and sync latency", &opts,
+                     "routine team team_pes median_us p99_us");
+  if (mype == 0) {
+    printf("# grid rows: %d PEs\n", xrange);
+  }
+
+  for (int t = 0; t < BENCH_NUM_TEAMS; t++) {
+    bool member = teams[t] != SHMEM_TEAM_INVALID;
+    int team_pes = member ? shmem_team_n_pes(teams[t]) : 0;
+
+    /* barrier_all and sync_all only exist for the world team */
+    bench_sync_t first = t == 0 ? BENCH_BARRIER_ALL : BENCH_TEAM_SYNC;
+    for (bench_sync_t kind = first; kind <= BENCH_TEAM_SYNC; kind++) {
+      const char *routine = kind == BENCH_BARRIER_ALL ? "shmem_barrier_all"
+                            : kind == BENCH_SYNC_ALL  ? "shmem_sync_all"
+                                                      : "shmem_team_sync";
+      double median = 0.0, p99 = 0.0;
+
+      shmem_barrier_all();
+      if (member) {
+        run_sync(kind, teams[t]);
+        BENCH_TIME_SAMPLES(samples, stats, opts, run_sync(kind, teams[t]));
+        median = stats.median;
+        p99 = stats.p99;
+      }
+
+      /* Team sizes differ across PEs for row and column teams */
+      double max_median = bench_max_across_pes(median);
+      double max_p99 = bench_max_across_pes(p99);
+      int max_team_pes = (int)bench_max_across_pes(team_pes);
+      if (mype == 0) {
+        printf("%-20s %6s %8d %12.3f %12.3f\n", routine, team_names[t],
+               max_team_pes, max_median * 1e6, max_p99 * 1e6);
+      }
+    }
+  }
+
+  shmem_barrier_all();
+
+  for (int t = 1; t < BENCH_NUM_TEAMS; t++) {
+    if (teams[t] != SHMEM_TEAM_INVALID) {
+      shmem_team_destroy(teams[t]);
+    }
+  }
+  free(samples);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file bench_locking_contention.c
+ * @brief Distributed lock contention benchmark.
+ *
+ * All PEs repeatedly acquire and release one lock for -d seconds (after
+ * -w untimed acquisitions each), acquiring either with shmem_set_lock or by spinning on shmem_test_lock,
+ * and releasing with shmem_clear_lock. Reported per variant:
+ *   - aggregate acquisitions per second over all PEs,
+ *   - fairness: the fewest and most acquisitions of any PE, and Jain's
+ *     index (1 when every PE gets the lock equally often, 1/npes when one
+ *     PE gets it every time),
+ *   - a histogram of acquisition latency over all PEs, in power-of-two
+ *     microsecond buckets labelled by their lower bound,
+ *   - the acquisition count of every PE.
+ */
+
+#include <shmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+#define BENCH_NUM_BUCKETS 24
+
+typedef enum { BENCH_SET_LOCK, BENCH_TEST_LOCK, BENCH_NUM_LOCKS } bench_lock_t;
+
+static const char *lock_names[BENCH_NUM_LOCKS] = {"shmem_set_lock",
+                                                  "shmem_test_lock"};
+
+/**
+ * @brief Histogram bucket of a latency: bucket b holds latencies below
+ *        2^b microseconds, and the last bucket everything longer.
+ */
+static int latency_bucket(double seconds) {
+  int bucket = 0;
+  double limit = 1e-6;
+  while (seconds >= limit && bucket < BENCH_NUM_BUCKETS - 1) {
+    limit *= 2;
+    bucket++;
+  }
+  return bucket;
+}
+
+/**
+ * @brief Acquires the lock with the given variant.
+ */
+static void acquire(bench_lock_t variant, long *lock) {
+  if (variant == BENCH_SET_LOCK) {
+    shmem_set_lock(lock);
+  } else {
+    while (shmem_test_lock(lock)) {
+    }
+  }
+}
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("LOCKING");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  long *lock = shmem_calloc(1, sizeof(long));
+  long *histogram = shmem_malloc(2 * BENCH_NUM_BUCKETS * sizeof(long));
+  long *total_histogram = histogram + BENCH_NUM_BUCKETS;
+  long *counts = shmem_calloc(npes, sizeof(long));
+  if (lock == NULL || histogram == NULL || counts == NULL) {
+    shmem_global_exit(EXIT_FAILURE);
+  }
+
+  bench_print_header("Lock contention", &opts,
+                     "routine acquisitions_per_s min_pe_count max_pe_count "
+                     "jain_fairness");
+  if (mype == 0) {
+    printf("# duration: %g s per variant\n", opts.duration);
+  }
+
+  for (int variant = 0; variant < BENCH_NUM_LOCKS; variant++) {
+    for (int b = 0; b < BENCH_NUM_BUCKETS; b++) {
+      histogram[b] = 0;
+    }
+
+    for (int i = 0; i < opts.warmup; i++) {
+      acquire(variant, lock);
+      shmem_clear_lock(lock);
+    }
+
+    shmem_barrier_all();
+
+    long count = 0;
+    double now = bench_time();
+    double end = now + opts.duration;
+    while (now < end) {
+      acquire(variant, lock);
+      double acquired = bench_time();
+      shmem_clear_lock(lock);
+
+      histogram[latency_bucket(acquired - now)]++;
+      count++;
+      now = bench_time();
+    }
+
+    shmem_long_p(&counts[mype], count, 0);
+    shmem_barrier_all();
+    shmem_long_sum_reduce(SHMEM_TEAM_WORLD, total_histogram, histogram,
+                          BENCH_NUM_BUCKETS);
+
+    if (mype == 0) {
+      long min = counts[0], max = counts[0];
+      double sum = 0.0, sum_squares = 0.0;
+      for (int pe = 0; pe < npes; pe++) {
+        min = counts[pe] < min ? counts[pe] : min;
+        max = counts[pe] > max ? counts[pe] : max;
+        sum += counts[pe];
+        sum_squares += (double)counts[pe] * counts[pe];
+      }
+
+      printf("%-16s %18.0f %12ld %12ld %14.3f\n", lock_names[variant],
+             sum / opts.duration, min, max,
+             sum_squares > 0 ? sum * sum / (npes * sum_squares) : 0.0);
+
+      /* Label buckets by lower bound, as the last one is open-ended */
+      printf("# %s acquisition latency: at_least_us count\n",
+             lock_names[variant]);
+      for (int b = 0; b < BENCH_NUM_BUCKETS; b++) {
+        if (total_histogram[b] > 0) {
+          printf("#   %10ld %12ld\n", b > 0 ? 1L << (b - 1) : 0L,
+                 total_histogram[b]);
+        }
+      }
+
+      printf("# %s acquisitions: pe count\n", lock_names[variant]);
+      for (int pe = 0; pe < npes; pe++) {
+        printf("#   %6d %12ld\n", pe, counts[pe]);
+      }
+    }
+  }
+
+  shmem_barrier_all();
+
+  shmem_free(counts);
+  shmem_free(histogram);
+  shmem_free(lock);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,362 @@
+/**
+ * @file bench_memory_allocation.c
+ * @brief Symmetric heap allocator benchmark.
+ *
+ * Times the collective symmetric heap routines:
+ *   - shmem_malloc, shmem_calloc and shmem_align (64-byte alignment) for
+ *     sizes from -m to -M bytes, each call followed by an untimed
+ *     shmem_free, and shmem_free itself on the shmem_malloc buffers,
+ *   - shmem_realloc sequences growing one buffer from -m to -M bytes by
+ *     doubling and shrinking it back,
+ *   - shmem_align of a small buffer for alignments from 8 bytes to 1 MiB.
+ * The reported median and p99 are the largest over all PEs.
+ *
+ * Fragmentation: fills the heap with equal blocks until shmem_malloc fails
+ * or BENCH_FRAGMENT_MAX_BLOCKS are held, then finds the largest block that
+ * can still be allocated, first with every block freed and then with every
+ * other block freed. The usable fraction is that largest block over the
+ * free bytes. Blocks are SHMEM_SYMMETRIC_SIZE / BENCH_FRAGMENT_MAX_BLOCKS
+ * bytes, rounded up to 64 KiB, so the count cap is only reached before the
+ * heap is full when SHMEM_SYMMETRIC_SIZE is unset and the default heap is
+ * larger than 256 MiB.
+ */
+
+#include <shmem.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+#define BENCH_ALIGNMENT 64
+#define BENCH_MAX_ALIGNMENT (1024 * 1024)
+#define BENCH_ALIGN_SWEEP_BYTES 64
+#define BENCH_FRAGMENT_MIN_BLOCK (64 * 1024)
+#define BENCH_FRAGMENT_MAX_BLOCKS 4096
+
+typedef enum {
+  BENCH_MALLOC,
+  BENCH_CALLOC,
+  BENCH_ALIGN,
+  BENCH_NUM_ALLOCATORS
+} bench_allocator_t;
+
+static const char *allocator_names[BENCH_NUM_ALLOCATORS] = {
+    "shmem_malloc", "shmem_calloc", "shmem_align"};
+
+/**
+ * @brief Allocates a symmetric buffer with the given routine.
+ */
+static void *allocate(bench_allocator_t allocator, size_t alignment,
+                      size_t size) {
+  switch (allocator) {
+  case BENCH_MALLOC:
+    return shmem_malloc(size);
+  case BENCH_CALLOC:
+    return shmem_calloc(1, size);
+  default:
+    return shmem_align(alignment, size);
+  }
+}
+
+/**
+ * @brief Prints the largest median and p99 over all PEs of a set of
+ *        samples. Collective.
+ */
+static void print_max_latency(const char *routine, size_t bytes,
+                              double *samples, int count) {
+  bench_stats_t stats;
+  bench_compute_stats(samples, count, &stats);
+  stats.median = bench_max_across_pes(stats.median);
+  stats.p99 = bench_max_across_pes(stats.p99);
+  bench_print_latency(routine, bytes, &stats);
+}
+
+/**
+ * @brief Exits if a collective allocation failed.
+ */
+static void check_allocation(void *buffer, const char *routine, size_t size) {
+  if (buffer == NULL) {
+    if (shmem_my_pe() == 0) {
+      fprintf(stderr,
+              "%s of %zu bytes failed; lower -M or raise "
+              "SHMEM_SYMMETRIC_SIZE\n",
+              routine, size);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+}
+
+/**
+ * @brief Block size of the fragmentation phase for the SHMEM_SYMMETRIC_SIZE
+ *        value `heap_size`, NULL if it is unset.
+ *
+ * The heap size is a byte count with an optional K, M, G or T suffix. The
+ * block is large enough for BENCH_FRAGMENT_MAX_BLOCKS blocks to fill the
+ * heap, and a multiple of BENCH_FRAGMENT_MIN_BLOCK.
+ */
+static size_t fragment_block_size(const char *heap_size) {
+  char *end;
+  int shift = 0;
+
+  if (heap_size == NULL) {
+    return BENCH_FRAGMENT_MIN_BLOCK;
+  }
+  unsigned long long bytes = strtoull(heap_size, &end, 10);
+  switch (*end) {
+  case 'k':
+  case 'K':
+    shift = 10;
+    break;
+  case 'm':
+  case 'M':
+    shift = 20;
+    break;
+  case 'g':
+  case 'G':
+    shift = 30;
+    break;
+  case 't':
+  case 'T':
+    shift = 40;
+    break;
+  }
+  if (end == heap_size || bytes > (SIZE_MAX >> shift)) {
+    return BENCH_FRAGMENT_MIN_BLOCK;
+  }
+
+  size_t block = ((size_t)bytes << shift) / BENCH_FRAGMENT_MAX_BLOCKS;
+  size_t units = (block + BENCH_FRAGMENT_MIN_BLOCK - 1) /
+                 BENCH_FRAGMENT_MIN_BLOCK;
+  return (units > 0 ? units : 1) * BENCH_FRAGMENT_MIN_BLOCK;
+}
+
+/**
+ * @brief Largest allocation that currently succeeds, to `block` bytes
+ *        granularity and at most `limit` bytes. Collective.
+ */
+static size_t largest_allocation(size_t block, size_t limit) {
+  size_t low = 0, high = limit / block;
+
+  while (low < high) {
+    size_t blocks = (low + high + 1) / 2;
+    void *buffer = shmem_malloc(blocks * block);
+    if (buffer != NULL) {
+      shmem_free(buffer);
+      low = blocks;
+    } else {
+      high = blocks - 1;
+    }
+  }
+  return low * block;
+}
+
+/**
+ * @brief Prints one row of the fragmentation report.
+ */
+static void print_fragmentation(const char *state, size_t blocks_held,
+                                size_t free_bytes, size_t largest) {
+  if (shmem_my_pe() == 0) {
+    printf("%-12s %12zu %14zu %14zu %10.3f\n", state, blocks_held, free_bytes,
+           largest, free_bytes > 0 ? (double)largest / free_bytes : 0.0);
+  }
+}
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+  opts.iterations = 100;
+  opts.warmup = 10;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  int steps = 0;
+  for (size_t size = opts.min_size; size <= opts.max_size; size *= 2) {
+    steps++;
+  }
+
+  double *samples = malloc(opts.iterations * sizeof(double));
+  double *free_samples = malloc(opts.iterations * sizeof(double));
+  double *grow_samples = malloc((size_t)steps * opts.iterations *
+                                sizeof(double));
+  double *shrink_samples = malloc((size_t)steps * opts.iterations *
+                                  sizeof(double));
+  if (samples == NULL || free_samples == NULL || grow_samples == NULL ||
+      shrink_samples == NULL) {
+    shmem_global_exit(EXIT_FAILURE);
+  }
+
+  const char *heap_size = getenv("SHMEM_SYMMETRIC_SIZE");
+
+  bench_print_header("Symmetric heap allocation latency", &opts,
+                     "routine bytes median_us p99_us");
+  if (mype == 0) {
+    printf("# SHMEM_SYMMETRIC_SIZE: %s\n",
+           heap_size != NULL ? heap_size : "(default)");
+  }
+
+  for (size_t size = opts.min_size; size <= opts.max_size; size *= 2) {
+    for (int a = 0; a < BENCH_NUM_ALLOCATORS; a++) {
+      for (int i = 0; i < opts.warmup; i++) {
+        void *buffer = allocate(a, BENCH_ALIGNMENT, size);
+        check_allocation(buffer, allocator_names[a], size);
+        shmem_free(buffer);
+      }
+
+      for (int i = 0; i < opts.iterations; i++) {
+        double start = bench_time();
+        void *buffer = allocate(a, BENCH_ALIGNMENT, size);
+        double allocated = bench_time();
+        check_allocation(buffer, allocator_names[a], size);
+        shmem_free(buffer);
+        samples[i] = allocated - start;
+        free_samples[i] = bench_time() - allocated;
+      }
+
+      print_max_latency(allocator_names[a], size, samples, opts.iterations);
+      if (a == BENCH_MALLOC) {
+        print_max_latency("shmem_free", size, free_samples, opts.iterations);
+      }
+    }
+  }
+
+  /* Realloc: grow one buffer step by step to -M, then shrink it back */
+  for (int i = -opts.warmup; i < opts.iterations; i++) {
+    void *buffer = shmem_malloc(opts.min_size);
+    check_allocation(buffer, "shmem_malloc", opts.min_size);
+
+    size_t size = opts.min_size;
+    for (int s = 1; s < steps; s++) {
+      size *= 2;
+      double start = bench_time();
+      buffer = shmem_realloc(buffer, size);
+      if (i >= 0) {
+        grow_samples[s * opts.iterations + i] = bench_time() - start;
+      }
+      check_allocation(buffer, "shmem_realloc", size);
+    }
+    for (int s = steps - 2; s >= 0; s--) {
+      size /= 2;
+      double start = bench_time();
+      buffer = shmem_realloc(buffer, size);
+      if (i >= 0) {
+        shrink_samples[s * opts.iterations + i] = bench_time() - start;
+      }
+      check_allocation(buffer, "shmem_realloc", size);
+    }
+
+    shmem_free(buffer);
+  }
+
+  size_t size = opts.min_size * 2;
+  for (int s = 1; s < steps; s++, size *= 2) {
+    print_max_latency("shmem_realloc(grow)", size,
+                      grow_samples + s * opts.iterations, opts.iterations);
+  }
+  size = opts.min_size;
+  for (int s = 0; s < steps - 1; s++, size *= 2) {
+    print_max_latency("shmem_realloc(shrink)", size,
+                      shrink_samples + s * opts.iterations, opts.iterations);
+  }
+
+  if (mype == 0) {
+    printf("\n");
+  }
+  bench_print_header("Symmetric heap alignment sweep", &opts,
+                     "routine alignment median_us p99_us");
+  if (mype == 0) {
+    printf("# bytes: %d\n", BENCH_ALIGN_SWEEP_BYTES);
+  }
+
+  for (size_t alignment = sizeof(long); alignment <= BENCH_MAX_ALIGNMENT;
+       alignment *= 2) {
+    for (int i = -opts.warmup; i < opts.iterations; i++) {
+      double start = bench_time();
+      void *buffer = shmem_align(alignment, BENCH_ALIGN_SWEEP_BYTES);
+      double elapsed = bench_time() - start;
+      check_allocation(buffer, "shmem_align", BENCH_ALIGN_SWEEP_BYTES);
+      shmem_free(buffer);
+      if (i >= 0) {
+        samples[i] = elapsed;
+      }
+    }
+
+    print_max_latency("shmem_align", alignment, samples, opts.iterations);
+  }
+
+  size_t block = fragment_block_size(heap_size);
+  if (mype == 0) {
+    printf("\n# Symmetric heap fragmentation\n");
+    printf("# block_bytes: %zu, at most %d blocks\n", block,
+           BENCH_FRAGMENT_MAX_BLOCKS);
+    printf("# state blocks_held free_bytes largest_block_bytes "
+           "usable_fraction\n");
+  }
+
+  /* Fill the heap with blocks until it runs out or the cap is reached */
+  size_t capacity = 0;
+  void **blocks = malloc(BENCH_FRAGMENT_MAX_BLOCKS * sizeof(void *));
+  if (blocks == NULL) {
+    shmem_global_exit(EXIT_FAILURE);
+  }
+  while (capacity < BENCH_FRAGMENT_MAX_BLOCKS) {
+    blocks[capacity] = shmem_malloc(block);
+    if (blocks[capacity] == NULL) {
+      break;
+    }
+    capacity++;
+  }
+  if (mype == 0 && capacity == BENCH_FRAGMENT_MAX_BLOCKS) {
+    printf("# stopped at the block cap, the heap may not be full; set "
+           "SHMEM_SYMMETRIC_SIZE to size the blocks\n");
+  }
+
+  size_t capacity_bytes = capacity * block;
+  print_fragmentation("full", capacity, 0, 0);
+
+  for (size_t b = 0; b < capacity; b++) {
+    shmem_free(blocks[b]);
+  }
+  print_fragmentation("empty", 0, capacity_bytes,
+                      largest_allocation(block, 2 * capacity_bytes));
+
+  /* Refill, then free every other block to leave block-sized holes */
+  size_t held = 0;
+  for (size_t b = 0; b < capacity; b++) {
+    blocks[b] = shmem_malloc(block);
+    held += blocks[b] != NULL;
+  }
+  for (size_t b = 0; b < capacity; b += 2) {
+    if (blocks[b] != NULL) {
+      shmem_free(blocks[b]);
+      blocks[b] = NULL;
+      held--;
+    }
+  }
+  print_fragmentation("holes", held,
+                      capacity_bytes - held * block,
+                      largest_allocation(block, capacity_bytes));
+
+  for (size_t b = 0; b < capacity; b++) {
+    if (blocks[b] != NULL) {
+      shmem_free(blocks[b]);
+    }
+  }
+
+  shmem_barrier_all();
+
+  free(blocks);
+  free(shrink_samples);
+  free(grow_samples);
+  free(free_samples);
+  free(samples);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
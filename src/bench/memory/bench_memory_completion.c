@@ -0,0 +1,187 @@
+/**
+ * @file bench_memory_completion.c
+ * @brief Completion cost benchmark for shmem_quiet, shmem_fence and
+ *        shmem_ctx_quiet.
+ *
+ * Every PE issues a number of puts with shmem_ctx_putmem_nbi, round robin
+ * over a number of distinct target PEs (the PEs after it), then times only
+ * the completion call: shmem_quiet or shmem_fence on the default context,
+ * or shmem_ctx_quiet on a created context. Fences are followed by an
+ * untimed shmem_quiet so that puts do not pile up across samples. Sweeps:
+ *   - outstanding puts: 0, 1, 4, 16, ... up to -W,
+ *   - put size: -m, 4 * -m, ... up to -M bytes,
+ *   - target PEs: 1, 2, 4, ... up to all other PEs.
+ * The reported median and p99 are the largest over all PEs.
+ */
+
+#include <shmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+typedef enum {
+  BENCH_QUIET,
+  BENCH_FENCE,
+  BENCH_CTX_QUIET,
+  BENCH_NUM_COMPLETIONS
+} bench_completion_t;
+
+static const char *completion_names[BENCH_NUM_COMPLETIONS] = {
+    "shmem_quiet", "shmem_fence", "shmem_ctx_quiet"};
+
+/**
+ * @brief Issues non-blocking puts round robin over the PEs after this one.
+ *
+ * @param ctx Context to issue the puts on.
+ * @param dest Symmetric destination of at least `count * size` bytes.
+ * @param source Private source of at least `size` bytes.
+ * @param size Bytes per put.
+ * @param count Number of puts.
+ * @param targets Number of distinct target PEs.
+ */
+static void issue_puts(shmem_ctx_t ctx, char *dest, const char *source,
+                       size_t size, int count, int targets) {
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+
+  for (int i = 0; i < count; i++) {
+    int peer = (mype + 1 + i % targets) % npes;
+    shmem_ctx_putmem_nbi(ctx, dest + (size_t)i * size, source, size, peer);
+  }
+}
+
+/**
+ * @brief Next number of outstanding puts: 0, 1, 4, 16, ..., ending with
+ *        `max`.
+ */
+static int next_count(int count, int max) {
+  if (count == 0) {
+    return 1;
+  }
+  return count < max && count * 4 > max ? max : count * 4;
+}
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+  opts.iterations = 100;
+  opts.warmup = 10;
+  opts.max_size = 64 * 1024;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("MEMORY");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  size_t buffer_size = opts.max_size * opts.max_window;
+  char *dest = shmem_malloc(buffer_size);
+  char *source = malloc(opts.max_size);
+  double *samples = malloc(opts.iterations * sizeof(double));
+  if (dest == NULL || source == NULL || samples == NULL) {
+    if (mype == 0) {
+      fprintf(stderr,
+              "Could not allocate a %zu byte symmetric buffer; lower -M or "
+              "-W, or raise SHMEM_SYMMETRIC_SIZE\n",
+              buffer_size);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+  memset(source, 1, opts.max_size);
+
+  /* The shmem_ctx_quiet sweep is collective, so run it only if every PE
+     has a context */
+  shmem_ctx_t ctx = SHMEM_CTX_DEFAULT;
+  bool created = shmem_ctx_create(0, &ctx) == 0;
+  bool have_ctx = bench_max_across_pes(!created) == 0;
+  if (created && !have_ctx) {
+    shmem_ctx_destroy(ctx);
+  }
+
+  bench_print_header("Completion cost", &opts,
+                     "routine targets puts bytes median_us p99_us");
+  if (mype == 0 && !have_ctx) {
+    printf("# shmem_ctx_create failed on some PEs, skipping "
+           "shmem_ctx_quiet\n");
+  }
+
+  for (int c = 0; c < BENCH_NUM_COMPLETIONS; c++) {
+    if (c == BENCH_CTX_QUIET && !have_ctx) {
+      continue;
+    }
+    shmem_ctx_t issue_ctx = c == BENCH_CTX_QUIET ? ctx : SHMEM_CTX_DEFAULT;
+
+    /* Doubling target counts, ending with all other PEs */
+    for (int t = 1; t < 2 * (npes - 1); t *= 2) {
+      int targets = t < npes - 1 ? t : npes - 1;
+
+      for (int count = 0; count <= opts.max_window;
+           count = next_count(count, opts.max_window)) {
+        for (size_t size = opts.min_size; size <= opts.max_size; size *= 4) {
+          shmem_barrier_all();
+
+          for (int i = -opts.warmup; i < opts.iterations; i++) {
+            issue_puts(issue_ctx, dest, source, size, count, targets);
+
+            double start = bench_time();
+            if (c == BENCH_QUIET) {
+              shmem_quiet();
+            } else if (c == BENCH_FENCE) {
+              shmem_fence();
+            } else {
+              shmem_ctx_quiet(ctx);
+            }
+            double elapsed = bench_time() - start;
+
+            if (c == BENCH_FENCE) {
+              shmem_quiet();
+            }
+            if (i >= 0) {
+              samples[i] = elapsed;
+            }
+          }
+
+          bench_stats_t stats;
+          bench_compute_stats(samples, opts.iterations, &stats);
+          double median = bench_max_across_pes(stats.median);
+          double p99 = bench_max_across_pes(stats.p99);
+          if (mype == 0) {
+            printf("%-16s %8d %6d %10zu %12.3f %12.3f\n", completion_names[c],
+                   targets, count, count > 0 ? size : 0, median * 1e6,
+                   p99 * 1e6);
+          }
+
+          /* Without outstanding puts the size does not matter */
+          if (count == 0) {
+            break;
+          }
+        }
+      }
+    }
+  }
+
+  shmem_barrier_all();
+
+  if (have_ctx) {
+    shmem_ctx_destroy(ctx);
+  }
+  free(samples);
+  free(source);
+  shmem_free(dest);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,169 @@
+/**
+ * @file bench_memory_malloc_hints.c
+ * @brief shmem_malloc_with_hints benchmark.
+ *
+ * Runs the same AMO and small-put workloads on symmetric buffers from plain
+ * shmem_malloc and from shmem_malloc_with_hints with
+ * SHMEM_MALLOC_ATOMICS_REMOTE, SHMEM_MALLOC_SIGNAL_REMOTE and both. Every
+ * PE targets the next PE, issuing windows of -W operations to distinct
+ * 64-bit words of the buffer, each window followed by shmem_quiet; for
+ * shmem_putmem_signal, the signals are also words of the buffer. Reported
+ * per workload and allocation are the largest median time per operation
+ * over all PEs and the speedup over plain shmem_malloc.
+ */
+
+#include <shmem.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+#define BENCH_NUM_ALLOCATIONS 4
+
+typedef enum {
+  BENCH_FETCH_ADD,
+  BENCH_ADD,
+  BENCH_COMPARE_SWAP,
+  BENCH_P,
+  BENCH_PUTMEM,
+  BENCH_PUTMEM_SIGNAL,
+  BENCH_NUM_WORKLOADS
+} bench_workload_t;
+
+static const char *workload_names[BENCH_NUM_WORKLOADS] = {
+    "shmem_uint64_atomic_fetch_add", "shmem_uint64_atomic_add",
+    "shmem_uint64_atomic_compare_swap", "shmem_uint64_p",
+    "shmem_putmem", "shmem_putmem_signal"};
+
+static const char *allocation_names[BENCH_NUM_ALLOCATIONS] = {
+    "shmem_malloc", "ATOMICS_REMOTE", "SIGNAL_REMOTE", "ATOMICS|SIGNAL"};
+
+static const long allocation_hints[BENCH_NUM_ALLOCATIONS] = {
+    0, SHMEM_MALLOC_ATOMICS_REMOTE, SHMEM_MALLOC_SIGNAL_REMOTE,
+    SHMEM_MALLOC_ATOMICS_REMOTE | SHMEM_MALLOC_SIGNAL_REMOTE};
+
+/**
+ * @brief Issues a window of operations to the peer and waits for them to
+ *        complete.
+ *
+ * @param workload Operation to issue.
+ * @param buffer Symmetric buffer of 2 * window words; the signals of
+ *               shmem_putmem_signal are the second half.
+ * @param window Number of operations.
+ * @param peer Target PE.
+ */
+static void run_window(bench_workload_t workload, uint64_t *buffer,
+                       int window, int peer) {
+  uint64_t value = 1;
+
+  for (int i = 0; i < window; i++) {
+    switch (workload) {
+    case BENCH_FETCH_ADD:
+      value += shmem_uint64_atomic_fetch_add(&buffer[i], 1, peer);
+      break;
+    case BENCH_ADD:
+      shmem_uint64_atomic_add(&buffer[i], 1, peer);
+      break;
+    case BENCH_COMPARE_SWAP:
+      value = shmem_uint64_atomic_compare_swap(&buffer[i], value, value + 1,
+                                               peer);
+      break;
+    case BENCH_P:
+      shmem_uint64_p(&buffer[i], value, peer);
+      break;
+    case BENCH_PUTMEM:
+      shmem_putmem(&buffer[i], &value, sizeof(value), peer);
+      break;
+    default:
+      shmem_putmem_signal(&buffer[i], &value, sizeof(value),
+                          &buffer[window + i], 1, SHMEM_SIGNAL_ADD, peer);
+      break;
+    }
+  }
+  shmem_quiet();
+}
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("MEMORY");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  size_t buffer_size = 2 * opts.max_window * sizeof(uint64_t);
+  uint64_t *buffers[BENCH_NUM_ALLOCATIONS];
+  buffers[0] = shmem_malloc(buffer_size);
+  for (int a = 1; a < BENCH_NUM_ALLOCATIONS; a++) {
+    buffers[a] = shmem_malloc_with_hints(buffer_size, allocation_hints[a]);
+  }
+  double *samples = malloc(opts.iterations * sizeof(double));
+  for (int a = 0; a < BENCH_NUM_ALLOCATIONS; a++) {
+    if (buffers[a] == NULL) {
+      if (mype == 0) {
+        fprintf(stderr, "Could not allocate the %s buffer\n",
+                allocation_names[a]);
+      }
+      shmem_global_exit(EXIT_FAILURE);
+    }
+  }
+  if (samples == NULL) {
+    shmem_global_exit(EXIT_FAILURE);
+  }
+
+  int peer = (mype + 1) % npes;
+  bench_stats_t stats;
+
+  bench_print_header("shmem_malloc_with_hints", &opts,
+                     "routine allocation us_per_op speedup");
+  if (mype == 0) {
+    printf("# window: %d\n", opts.max_window);
+  }
+
+  for (int w = 0; w < BENCH_NUM_WORKLOADS; w++) {
+    double baseline = 0.0;
+
+    for (int a = 0; a < BENCH_NUM_ALLOCATIONS; a++) {
+      for (int i = 0; i < 2 * opts.max_window; i++) {
+        buffers[a][i] = 1;
+      }
+      shmem_barrier_all();
+
+      BENCH_TIME_SAMPLES(samples, stats, opts,
+                         run_window(w, buffers[a], opts.max_window, peer));
+
+      double per_op = bench_max_across_pes(stats.median) / opts.max_window;
+      if (a == 0) {
+        baseline = per_op;
+      }
+      if (mype == 0) {
+        printf("%-34s %16s %12.4f %10.3f\n", workload_names[w],
+               allocation_names[a], per_op * 1e6, baseline / per_op);
+      }
+    }
+  }
+
+  shmem_barrier_all();
+
+  free(samples);
+  for (int a = BENCH_NUM_ALLOCATIONS - 1; a >= 0; a--) {
+    shmem_free(buffers[a]);
+  }
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
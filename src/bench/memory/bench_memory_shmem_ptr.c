@@ -0,0 +1,172 @@
+/**
+ * @file bench_memory_shmem_ptr.c
+ * @brief shmem_ptr direct access benchmark versus RMA calls.
+ *
+ * PE 0 asks shmem_ptr for a pointer to a symmetric buffer on every other
+ * PE and lists which peers are load/store reachable. For each reachable
+ * peer and sizes from -m to -M bytes, it times writing the peer's buffer
+ * with shmem_putmem + shmem_quiet, a loop of long stores through the
+ * pointer and memcpy through the pointer, and reading it with
+ * shmem_getmem, a loop of long loads and memcpy. Like shmem_quiet after
+ * the put, a sequentially consistent fence after the stores and memcpy
+ * orders them before whatever PE 0 does next. Reported are the median
+ * time, bandwidth, and the speedup over shmem_putmem or shmem_getmem.
+ * Store and load loops only run for whole longs. Only PE 0 measures; the
+ * other PEs wait in the final barrier.
+ */
+
+#include <shmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+typedef enum {
+  BENCH_PUTMEM,
+  BENCH_STORE,
+  BENCH_MEMCPY_TO,
+  BENCH_GETMEM,
+  BENCH_LOAD,
+  BENCH_MEMCPY_FROM,
+  BENCH_NUM_ACCESSES
+} bench_access_t;
+
+static const char *access_names[BENCH_NUM_ACCESSES] = {
+    "shmem_putmem", "store", "memcpy(to_peer)",
+    "shmem_getmem", "load",  "memcpy(from_peer)"};
+
+static volatile long sink;
+
+/**
+ * @brief Writes or reads `size` bytes of a peer's buffer.
+ *
+ * @param access How to access the buffer.
+ * @param buffer Symmetric buffer.
+ * @param peer_buffer shmem_ptr of `buffer` on the peer.
+ * @param local Private buffer of at least `size` bytes.
+ * @param size Bytes to access.
+ * @param peer Peer PE.
+ */
+static void run_access(bench_access_t access, char *buffer,
+                       char *peer_buffer, char *local, size_t size,
+                       int peer) {
+  volatile long *words = (volatile long *)peer_buffer;
+  size_t count = size / sizeof(long);
+  long sum = 0;
+
+  switch (access) {
+  case BENCH_PUTMEM:
+    shmem_putmem(buffer, local, size, peer);
+    shmem_quiet();
+    break;
+  case BENCH_STORE:
+    for (size_t i = 0; i < count; i++) {
+      words[i] = (long)i;
+    }
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    break;
+  case BENCH_MEMCPY_TO:
+    memcpy(peer_buffer, local, size);
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    break;
+  case BENCH_GETMEM:
+    shmem_getmem(local, buffer, size, peer);
+    break;
+  case BENCH_LOAD:
+    for (size_t i = 0; i < count; i++) {
+      sum += words[i];
+    }
+    sink = sum;
+    break;
+  default:
+    memcpy(local, peer_buffer, size);
+    break;
+  }
+}
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+  opts.iterations = 100;
+  opts.warmup = 10;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("MEMORY");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  char *buffer = shmem_malloc(opts.max_size);
+  char *local = malloc(opts.max_size);
+  double *samples = malloc(opts.iterations * sizeof(double));
+  if (buffer == NULL || local == NULL || samples == NULL) {
+    if (mype == 0) {
+      fprintf(stderr, "Could not allocate %zu byte buffers\n", opts.max_size);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+  memset(local, 1, opts.max_size);
+
+  bench_print_header("shmem_ptr direct access versus RMA", &opts,
+                     "routine peer bytes median_us MB_per_s speedup");
+
+  if (mype == 0) {
+    printf("# measured by PE 0 against each other PE\n");
+    printf("# peer load_store_reachable\n");
+    for (int peer = 1; peer < npes; peer++) {
+      printf("#   %6d %s\n", peer,
+             shmem_ptr(buffer, peer) != NULL ? "yes" : "no");
+    }
+
+    bench_stats_t stats;
+    for (int peer = 1; peer < npes; peer++) {
+      char *peer_buffer = shmem_ptr(buffer, peer);
+      if (peer_buffer == NULL) {
+        continue;
+      }
+
+      for (size_t size = opts.min_size; size <= opts.max_size; size *= 2) {
+        double baseline = 0.0;
+
+        for (int a = 0; a < BENCH_NUM_ACCESSES; a++) {
+          bool word_access = a == BENCH_STORE || a == BENCH_LOAD;
+          if (word_access && size % sizeof(long) != 0) {
+            continue;
+          }
+
+          BENCH_TIME_SAMPLES(samples, stats, opts,
+                             run_access(a, buffer, peer_buffer, local, size,
+                                        peer));
+
+          if (a == BENCH_PUTMEM || a == BENCH_GETMEM) {
+            baseline = stats.median;
+          }
+          printf("%-20s %6d %10zu %12.3f %12.2f %10.3f\n", access_names[a],
+                 peer, size, stats.median * 1e6, size / stats.median / 1e6,
+                 baseline / stats.median);
+        }
+      }
+    }
+  }
+
+  shmem_barrier_all();
+
+  free(samples);
+  free(local);
+  shmem_free(buffer);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
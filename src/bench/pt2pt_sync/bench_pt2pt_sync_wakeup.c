@@ -0,0 +1,269 @@
+/**
+ * @file bench_pt2pt_sync_wakeup.c
+ * @brief Wake-up latency benchmark for the wait_until/test family.
+ *
+ * PE 0 and PE 1 ping-pong through arrays of N long ivars, N doubling from 1
+ * to -W. Each round, the sender updates the receiver's ivars with
+ * shmem_long_atomic_set or shmem_long_p, and the receiver detects the
+ * update with one of:
+ *   - shmem_long_wait_until or shmem_long_test polling on the single ivar
+ *     the sender updated, run once since N does not matter to them,
+ *   - shmem_long_wait_until_any/_some and their _vector forms, watching
+ *     all N ivars for the one the sender updated (the ivar index rotates
+ *     every round),
+ *   - shmem_long_wait_until_all and its _vector form, watching all N ivars,
+ *     all of which the sender updates (fan-in completion),
+ *   - the matching shmem_long_test_any/_some/_all forms, polled in a loop
+ *     until they report the update.
+ * Reported latencies are one way, half of each round trip.
+ */
+
+#include <shmem.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+typedef enum {
+  BENCH_WAIT_UNTIL,
+  BENCH_TEST,
+  BENCH_WAIT_UNTIL_ANY,
+  BENCH_TEST_ANY,
+  BENCH_WAIT_UNTIL_SOME,
+  BENCH_TEST_SOME,
+  BENCH_WAIT_UNTIL_ALL,
+  BENCH_TEST_ALL,
+  BENCH_WAIT_UNTIL_ANY_VECTOR,
+  BENCH_TEST_ANY_VECTOR,
+  BENCH_WAIT_UNTIL_SOME_VECTOR,
+  BENCH_TEST_SOME_VECTOR,
+  BENCH_WAIT_UNTIL_ALL_VECTOR,
+  BENCH_TEST_ALL_VECTOR,
+  BENCH_NUM_WAITS
+} bench_wait_t;
+
+static const char *wait_names[BENCH_NUM_WAITS] = {
+    "shmem_long_wait_until",
+    "shmem_long_test",
+    "shmem_long_wait_until_any",
+    "shmem_long_test_any",
+    "shmem_long_wait_until_some",
+    "shmem_long_test_some",
+    "shmem_long_wait_until_all",
+    "shmem_long_test_all",
+    "shmem_long_wait_until_any_vector",
+    "shmem_long_test_any_vector",
+    "shmem_long_wait_until_some_vector",
+    "shmem_long_test_some_vector",
+    "shmem_long_wait_until_all_vector",
+    "shmem_long_test_all_vector"};
+
+static long *ivars;
+static long *cmp_values;
+static size_t *indices;
+
+/**
+ * @brief True if the sender updates every ivar for this way of waiting.
+ */
+static bool updates_all(bench_wait_t wait) {
+  return wait == BENCH_WAIT_UNTIL_ALL || wait == BENCH_TEST_ALL ||
+         wait == BENCH_WAIT_UNTIL_ALL_VECTOR || wait == BENCH_TEST_ALL_VECTOR;
+}
+
+/**
+ * @brief True if this way of waiting watches a single ivar.
+ */
+static bool watches_one(bench_wait_t wait) {
+  return wait == BENCH_WAIT_UNTIL || wait == BENCH_TEST;
+}
+
+/**
+ * @brief Updates the peer's ivars to `value`.
+ *
+ * @param wait How the peer waits for the update.
+ * @param use_p True to update with shmem_long_p, false with
+ *              shmem_long_atomic_set.
+ * @param nivars Number of ivars the peer watches.
+ * @param index Ivar to update if the peer waits for just one.
+ * @param value New value of the ivars.
+ * @param peer PE to notify.
+ */
+static void notify(bench_wait_t wait, bool use_p, size_t nivars, size_t index,
+                   long value, int peer) {
+  size_t first = updates_all(wait) ? 0 : index;
+  size_t last = updates_all(wait) ? nivars : index + 1;
+
+  for (size_t i = first; i < last; i++) {
+    if (use_p) {
+      shmem_long_p(&ivars[i], value, peer);
+    } else {
+      shmem_long_atomic_set(&ivars[i], value, peer);
+    }
+  }
+}
+
+/**
+ * @brief Waits until this PE's ivars reach `value`.
+ *
+ * @param wait How to wait.
+ * @param nivars Number of ivars to watch.
+ * @param index Ivar the sender updates if it updates just one.
+ * @param value Value the updated ivars reach.
+ */
+static void wait_for(bench_wait_t wait, size_t nivars, size_t index,
+                     long value) {
+  if (wait >= BENCH_WAIT_UNTIL_ANY_VECTOR) {
+    for (size_t i = 0; i < nivars; i++) {
+      cmp_values[i] = value;
+    }
+  }
+
+  switch (wait) {
+  case BENCH_WAIT_UNTIL:
+    shmem_long_wait_until(&ivars[index], SHMEM_CMP_GE, value);
+    break;
+  case BENCH_TEST:
+    while (!shmem_long_test(&ivars[index], SHMEM_CMP_GE, value)) {
+    }
+    break;
+  case BENCH_WAIT_UNTIL_ANY:
+    shmem_long_wait_until_any(ivars, nivars, NULL, SHMEM_CMP_GE, value);
+    break;
+  case BENCH_TEST_ANY:
+    while (shmem_long_test_any(ivars, nivars, NULL, SHMEM_CMP_GE, value) ==
+           SIZE_MAX) {
+    }
+    break;
+  case BENCH_WAIT_UNTIL_SOME:
+    shmem_long_wait_until_some(ivars, nivars, indices, NULL, SHMEM_CMP_GE,
+                               value);
+    break;
+  case BENCH_TEST_SOME:
+    while (shmem_long_test_some(ivars, nivars, indices, NULL, SHMEM_CMP_GE,
+                                value) == 0) {
+    }
+    break;
+  case BENCH_WAIT_UNTIL_ALL:
+    shmem_long_wait_until_all(ivars, nivars, NULL, SHMEM_CMP_GE, value);
+    break;
+  case BENCH_TEST_ALL:
+    while (!shmem_long_test_all(ivars, nivars, NULL, SHMEM_CMP_GE, value)) {
+    }
+    break;
+  case BENCH_WAIT_UNTIL_ANY_VECTOR:
+    shmem_long_wait_until_any_vector(ivars, nivars, NULL, SHMEM_CMP_GE,
+                                     cmp_values);
+    break;
+  case BENCH_TEST_ANY_VECTOR:
+    while (shmem_long_test_any_vector(ivars, nivars, NULL, SHMEM_CMP_GE,
+                                      cmp_values) == SIZE_MAX) {
+    }
+    break;
+  case BENCH_WAIT_UNTIL_SOME_VECTOR:
+    shmem_long_wait_until_some_vector(ivars, nivars, indices, NULL,
+                                      SHMEM_CMP_GE, cmp_values);
+    break;
+  case BENCH_TEST_SOME_VECTOR:
+    while (shmem_long_test_some_vector(ivars, nivars, indices, NULL,
+                                       SHMEM_CMP_GE, cmp_values) == 0) {
+    }
+    break;
+  case BENCH_WAIT_UNTIL_ALL_VECTOR:
+    shmem_long_wait_until_all_vector(ivars, nivars, NULL, SHMEM_CMP_GE,
+                                     cmp_values);
+    break;
+  default:
+    while (!shmem_long_test_all_vector(ivars, nivars, NULL, SHMEM_CMP_GE,
+                                       cmp_values)) {
+    }
+    break;
+  }
+}
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+  opts.max_window = 1024;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("PT2PT_SYNC");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  ivars = shmem_calloc(opts.max_window, sizeof(long));
+  cmp_values = malloc(opts.max_window * sizeof(long));
+  indices = malloc(opts.max_window * sizeof(size_t));
+  double *samples = malloc(opts.iterations * sizeof(double));
+  if (ivars == NULL || cmp_values == NULL || indices == NULL ||
+      samples == NULL) {
+    if (mype == 0) {
+      fprintf(stderr, "Could not allocate %d ivars\n", opts.max_window);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+
+  bool active = mype < 2;
+  int peer = 1 - mype;
+  bench_stats_t stats;
+
+  bench_print_header("Point-to-point wake-up latency", &opts,
+                     "routine update ivars median_us p99_us");
+
+  for (int wait = 0; wait < BENCH_NUM_WAITS; wait++) {
+    for (int use_p = 0; use_p <= 1; use_p++) {
+      size_t max_ivars = watches_one(wait) ? 1 : (size_t)opts.max_window;
+      for (size_t nivars = 1; nivars <= max_ivars; nivars *= 2) {
+        long round = 0;
+
+        shmem_barrier_all();
+        for (size_t i = 0; i < nivars; i++) {
+          ivars[i] = 0;
+        }
+        shmem_barrier_all();
+
+        if (active) {
+          BENCH_TIME_SAMPLES(samples, stats, opts, {
+            round++;
+            size_t index = round % nivars;
+            if (mype == 0) {
+              notify(wait, use_p, nivars, index, round, peer);
+              wait_for(wait, nivars, index, round);
+            } else {
+              wait_for(wait, nivars, index, round);
+              notify(wait, use_p, nivars, index, round, peer);
+            }
+          });
+
+          if (mype == 0) {
+            printf("%-34s %10s %6zu %12.3f %12.3f\n", wait_names[wait],
+                   use_p ? "p" : "atomic_set", nivars, stats.median / 2 * 1e6,
+                   stats.p99 / 2 * 1e6);
+          }
+        }
+      }
+    }
+  }
+
+  shmem_barrier_all();
+
+  free(samples);
+  free(indices);
+  free(cmp_values);
+  shmem_free(ivars);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
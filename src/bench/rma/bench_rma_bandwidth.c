@@ -0,0 +1,143 @@
+/**
+ * @file bench_rma_bandwidth.c
+ * @brief Windowed bandwidth benchmark for shmem_putmem_nbi and
+ *        shmem_getmem_nbi.
+ *
+ * PE i is paired with PE i + npes/2. Each sample issues a window of
+ * non-blocking transfers followed by one shmem_quiet(). In unidirectional
+ * mode only the first PE of each pair transfers; in bidirectional mode both
+ * do. Message sizes sweep from -m to -M bytes and windows from 1 to -W.
+ * A window that does not improve bandwidth over a window of 1 means the
+ * transfers are not being pipelined.
+ */
+
+#include <shmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+static char *remote;
+static char *local;
+static double *samples;
+
+/**
+ * @brief Times windows of non-blocking transfers to or from a peer.
+ *
+ * @param put True for shmem_putmem_nbi, false for shmem_getmem_nbi.
+ * @param active True if this PE transfers; false if it is only a target.
+ * @param peer PE this PE is paired with.
+ * @param size Message size in bytes.
+ * @param window Transfers issued per shmem_quiet().
+ * @param opts Benchmark options.
+ * @return Bandwidth in MB/s summed over all PEs.
+ */
+static double time_windows(bool put, bool active, int peer, size_t size,
+                           int window, const bench_options_t *opts) {
+  bench_stats_t stats;
+  double bandwidth = 0.0;
+
+  shmem_barrier_all();
+
+  if (active && put) {
+    BENCH_TIME_SAMPLES(samples, stats, *opts, {
+      for (int w = 0; w < window; w++) {
+        shmem_putmem_nbi(remote, local, size, peer);
+      }
+      shmem_quiet();
+    });
+  } else if (active) {
+    BENCH_TIME_SAMPLES(samples, stats, *opts, {
+      for (int w = 0; w < window; w++) {
+        shmem_getmem_nbi(local, remote, size, peer);
+      }
+      shmem_quiet();
+    });
+  }
+
+  if (active) {
+    bandwidth = (double)size * window / stats.mean / 1e6;
+  }
+
+  return bench_sum_across_pes(bandwidth);
+}
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+  opts.iterations = 100;
+  opts.warmup = 10;
+  opts.max_size = 1024 * 1024;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("RMA");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  remote = shmem_malloc(opts.max_size);
+  local = malloc(opts.max_size);
+  samples = malloc(opts.iterations * sizeof(double));
+  if (remote == NULL || local == NULL || samples == NULL) {
+    if (mype == 0) {
+      fprintf(stderr, "Could not allocate %zu byte buffers\n", opts.max_size);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+  memset(remote, 0, opts.max_size);
+  memset(local, 1, opts.max_size);
+
+  /* An odd PE out has no peer and takes part only in the collectives */
+  int npairs = npes / 2;
+  bool paired = mype < 2 * npairs;
+  bool initiator = mype < npairs;
+  int peer = initiator ? mype + npairs : mype - npairs;
+
+  bench_print_header("RMA bandwidth", &opts,
+                     "routine mode bytes window pair_MB_per_s "
+                     "aggregate_MB_per_s");
+  if (mype == 0) {
+    printf("# pairs: %d\n", npairs);
+  }
+
+  for (int bidirectional = 0; bidirectional <= 1; bidirectional++) {
+    const char *mode = bidirectional ? "bi" : "uni";
+    bool active = paired && (initiator || bidirectional);
+
+    for (int put = 1; put >= 0; put--) {
+      const char *routine = put ? "shmem_putmem_nbi" : "shmem_getmem_nbi";
+
+      for (size_t size = opts.min_size; size <= opts.max_size; size *= 2) {
+        for (int window = 1; window <= opts.max_window; window *= 2) {
+          double aggregate =
+              time_windows(put, active, peer, size, window, &opts);
+          if (mype == 0) {
+            printf("%-20s %4s %10zu %6d %14.2f %18.2f\n", routine, mode, size,
+                   window, aggregate / npairs, aggregate);
+          }
+        }
+      }
+    }
+  }
+
+  shmem_barrier_all();
+
+  free(samples);
+  free(local);
+  shmem_free(remote);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+/**
+ * @file bench_rma_latency.c
+ * @brief Latency benchmark for the blocking RMA routines.
+ *
+ * Puts are timed as a ping-pong between PE 0 and PE 1: PE 0 puts the
+ * message, fences and sets a flag on PE 1; PE 1 waits for the flag and
+ * answers the same way. Each sample is half of the round trip seen by
+ * PE 0. Blocking gets are a round trip on their own, so PE 0 times each
+ * call against PE 1 while PE 1 stays passive. The other PEs only wait.
+ *
+ * The typed put/get routines of SHMEM_STANDARD_RMA_TYPE_TABLE and
+ * putmem/getmem sweep message sizes from -m to -M bytes; the typed p/g
+ * routines move one element. Each routine is also run on a created
+ * context.
+ */
+
+#include <shmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+#include "type_tables.h"
+
+/* Times STMT on PE 0 alone */
+#define BENCH_RMA_LATENCY(ROUTINE, BYTES, STMT)                                \
+  do {                                                                         \
+    if (mype == 0) {                                                           \
+      BENCH_TIME_SAMPLES(samples, stats, opts, STMT);                          \
+      bench_print_latency(ROUTINE, BYTES, &stats);                             \
+    }                                                                          \
+  } while (0)
+
+/* Times a ping-pong between PE 0 and PE 1 in which each side runs PUT to
+   `peer` on CTX, then fences and sets the flag on `peer` */
+#define BENCH_RMA_PING_PONG(ROUTINE, BYTES, CTX, PUT)                          \
+  do {                                                                         \
+    if (mype < 2) {                                                            \
+      for (int i = -opts.warmup; i < opts.iterations; i++) {                   \
+        long seq = ++sequence;                                                 \
+        double start = bench_time();                                           \
+        if (mype == 1) {                                                       \
+          shmem_long_wait_until(flag, SHMEM_CMP_GE, seq);                      \
+        }                                                                      \
+        PUT;                                                                   \
+        shmem_ctx_fence(CTX);                                                  \
+        shmem_ctx_long_p(CTX, flag, seq, peer);                                \
+        if (mype == 0) {                                                       \
+          shmem_long_wait_until(flag, SHMEM_CMP_GE, seq);                      \
+        }                                                                      \
+        if (i >= 0) {                                                          \
+          samples[i] = (bench_time() - start) / 2;                             \
+        }                                                                      \
+      }                                                                        \
+      bench_compute_stats(samples, opts.iterations, &stats);                   \
+      bench_print_latency(ROUTINE, BYTES, &stats);                             \
+    }                                                                          \
+  } while (0)
+
+#define BENCH_RMA_TYPE_LATENCY(TYPE, TYPENAME)                                 \
+  do {                                                                         \
+    TYPE *dest = (TYPE *)remote;                                               \
+    TYPE *src = (TYPE *)local;                                                 \
+    TYPE value = 1;                                                            \
+                                                                               \
+    for (size_t n = first_count(opts.min_size, sizeof(TYPE));                  \
+         n <= opts.max_size / sizeof(TYPE); n *= 2) {                          \
+      size_t bytes = n * sizeof(TYPE);                                         \
+      BENCH_RMA_PING_PONG("shmem_" #TYPENAME "_put", bytes, SHMEM_CTX_DEFAULT, \
+                          shmem_##TYPENAME##_put(dest, src, n, peer));         \
+      BENCH_RMA_LATENCY("shmem_" #TYPENAME "_get", bytes,                      \
+                        shmem_##TYPENAME##_get(src, dest, n, peer));           \
+      if (have_ctx) {                                                          \
+        BENCH_RMA_PING_PONG(                                                   \
+            "shmem_ctx_" #TYPENAME "_put", bytes, ctx,                         \
+            shmem_ctx_##TYPENAME##_put(ctx, dest, src, n, peer));              \
+        BENCH_RMA_LATENCY(                                                     \
+            "shmem_ctx_" #TYPENAME "_get", bytes,                              \
+            shmem_ctx_##TYPENAME##_get(ctx, src, dest, n, peer));              \
+      }                                                                        \
+    }                                                                          \
+                                                                               \
+    BENCH_RMA_PING_PONG("shmem_" #TYPENAME "_p", sizeof(TYPE),                 \
+                        SHMEM_CTX_DEFAULT,                                     \
+                        shmem_##TYPENAME##_p(dest, value, peer));              \
+    BENCH_RMA_LATENCY("shmem_" #TYPENAME "_g", sizeof(TYPE),                   \
+                      value = shmem_##TYPENAME##_g(dest, peer));               \
+    if (have_ctx) {                                                            \
+      BENCH_RMA_PING_PONG("shmem_ctx_" #TYPENAME "_p", sizeof(TYPE), ctx,      \
+                          shmem_ctx_##TYPENAME##_p(ctx, dest, value, peer));   \
+      BENCH_RMA_LATENCY("shmem_ctx_" #TYPENAME "_g", sizeof(TYPE),             \
+                        value = shmem_ctx_##TYPENAME##_g(ctx, dest, peer));    \
+    }                                                                          \
+  } while (0)
+
+/**
+ * @brief Smallest element count of at least `min_size` bytes.
+ */
+static size_t first_count(size_t min_size, size_t elem_size) {
+  size_t count = (min_size + elem_size - 1) / elem_size;
+  return count > 0 ? count : 1;
+}
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("RMA");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  size_t buffer_size = opts.max_size < sizeof(long double)
+                           ? sizeof(long double)
+                           : opts.max_size;
+  char *remote = shmem_malloc(buffer_size);
+  long *flag = shmem_malloc(sizeof(long));
+  char *local = malloc(buffer_size);
+  double *samples = malloc(opts.iterations * sizeof(double));
+  if (remote == NULL || flag == NULL || local == NULL || samples == NULL) {
+    if (mype == 0) {
+      fprintf(stderr, "Could not allocate %zu byte buffers\n", buffer_size);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+  memset(remote, 0, buffer_size);
+  memset(local, 1, buffer_size);
+  *flag = 0;
+
+  /* PE 1 answers ping-pongs on the context too, so both must have one */
+  shmem_ctx_t ctx = SHMEM_CTX_DEFAULT;
+  bool created = shmem_ctx_create(0, &ctx) == 0;
+  bool have_ctx = bench_max_across_pes(!created) == 0;
+  if (created && !have_ctx) {
+    shmem_ctx_destroy(ctx);
+  }
+  if (!have_ctx && mype == 0) {
+    printf("# shmem_ctx_create failed on some PEs, skipping the ctx "
+           "variants\n");
+  }
+
+  int peer = mype == 0 ? 1 : 0;
+  long sequence = 0;
+  bench_stats_t stats;
+
+  bench_print_header("RMA latency", &opts,
+                     "routine bytes median_us p99_us");
+  if (mype == 0) {
+    printf("# put and p rows: half a ping-pong round trip between PE 0 and "
+           "PE 1\n");
+    printf("# get and g rows: blocking call on PE 0 against PE 1\n");
+  }
+  shmem_barrier_all();
+
+#define X(type, shmem_types) BENCH_RMA_TYPE_LATENCY(type, shmem_types);
+  SHMEM_STANDARD_RMA_TYPE_TABLE(X)
+#undef X
+
+  for (size_t size = opts.min_size; size <= opts.max_size; size *= 2) {
+    BENCH_RMA_PING_PONG("shmem_putmem", size, SHMEM_CTX_DEFAULT,
+                        shmem_putmem(remote, local, size, peer));
+    BENCH_RMA_LATENCY("shmem_getmem", size,
+                      shmem_getmem(local, remote, size, peer));
+    if (have_ctx) {
+      BENCH_RMA_PING_PONG("shmem_ctx_putmem", size, ctx,
+                          shmem_ctx_putmem(ctx, remote, local, size, peer));
+      BENCH_RMA_LATENCY("shmem_ctx_getmem", size,
+                        shmem_ctx_getmem(ctx, local, remote, size, peer));
+    }
+  }
+
+  shmem_barrier_all();
+
+  if (have_ctx) {
+    shmem_ctx_destroy(ctx);
+  }
+  free(samples);
+  free(local);
+  shmem_free(flag);
+  shmem_free(remote);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
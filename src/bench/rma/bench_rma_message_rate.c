@@ -0,0 +1,126 @@
+/**
+ * @file bench_rma_message_rate.c
+ * @brief Small-message rate benchmark for shmem_p, shmem_g and
+ *        shmem_atomic_set.
+ *
+ * PE i targets PE i + npes/2, so every pair runs concurrently and the
+ * aggregate rate covers all PEs of the job. Each sample issues a window of
+ * -W single-element operations to consecutive elements, followed by
+ * shmem_quiet() for the puts. shmem_p and shmem_g cover every type in
+ * SHMEM_STANDARD_RMA_TYPE_TABLE; shmem_atomic_set covers the types in
+ * SHMEM_EXTENDED_AMO_TYPE_TABLE, the only ones it is defined for.
+ */
+
+#include <shmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+#include "type_tables.h"
+
+/* Reports the rate of `window` operations per sample, summed over PEs */
+#define BENCH_MESSAGE_RATE(ROUTINE, BYTES, STMT)                               \
+  do {                                                                         \
+    double rate = 0.0;                                                         \
+    shmem_barrier_all();                                                       \
+    if (initiator) {                                                           \
+      BENCH_TIME_SAMPLES(samples, stats, opts, STMT);                          \
+      rate = opts.max_window / stats.mean / 1e6;                               \
+    }                                                                          \
+    double aggregate = bench_sum_across_pes(rate);                             \
+    if (mype == 0) {                                                           \
+      printf("%-32s %6zu %14.3f %18.3f\n", ROUTINE, (size_t)(BYTES),           \
+             aggregate / npairs, aggregate);                                   \
+    }                                                                          \
+  } while (0)
+
+#define BENCH_RMA_MESSAGE_RATE(TYPE, TYPENAME)                                 \
+  do {                                                                         \
+    TYPE *dest = (TYPE *)remote;                                               \
+    TYPE value = 1;                                                            \
+                                                                               \
+    BENCH_MESSAGE_RATE("shmem_" #TYPENAME "_p", sizeof(TYPE), {                \
+      for (int w = 0; w < opts.max_window; w++) {                              \
+        shmem_##TYPENAME##_p(&dest[w], value, peer);                           \
+      }                                                                        \
+      shmem_quiet();                                                           \
+    });                                                                        \
+    BENCH_MESSAGE_RATE("shmem_" #TYPENAME "_g", sizeof(TYPE), {                \
+      for (int w = 0; w < opts.max_window; w++) {                              \
+        value += shmem_##TYPENAME##_g(&dest[w], peer);                         \
+      }                                                                        \
+    });                                                                        \
+  } while (0)
+
+#define BENCH_AMO_MESSAGE_RATE(TYPE, TYPENAME)                                 \
+  do {                                                                         \
+    TYPE *dest = (TYPE *)remote;                                               \
+    TYPE value = 1;                                                            \
+                                                                               \
+    BENCH_MESSAGE_RATE("shmem_" #TYPENAME "_atomic_set", sizeof(TYPE), {       \
+      for (int w = 0; w < opts.max_window; w++) {                              \
+        shmem_##TYPENAME##_atomic_set(&dest[w], value, peer);                  \
+      }                                                                        \
+      shmem_quiet();                                                           \
+    });                                                                        \
+  } while (0)
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("RMA");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  long double *remote = shmem_calloc(opts.max_window, sizeof(long double));
+  double *samples = malloc(opts.iterations * sizeof(double));
+  if (remote == NULL || samples == NULL) {
+    if (mype == 0) {
+      fprintf(stderr, "Could not allocate a window of %d elements\n",
+              opts.max_window);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+
+  int npairs = npes / 2;
+  bool initiator = mype < npairs;
+  int peer = mype + npairs;
+  bench_stats_t stats;
+
+  bench_print_header("RMA message rate", &opts,
+                     "routine bytes pair_Mops_per_s aggregate_Mops_per_s");
+  if (mype == 0) {
+    printf("# pairs: %d, operations per sample: %d\n", npairs,
+           opts.max_window);
+  }
+
+#define X(type, shmem_types) BENCH_RMA_MESSAGE_RATE(type, shmem_types);
+  SHMEM_STANDARD_RMA_TYPE_TABLE(X)
+#undef X
+
+#define X(type, shmem_types) BENCH_AMO_MESSAGE_RATE(type, shmem_types);
+  SHMEM_EXTENDED_AMO_TYPE_TABLE(X)
+#undef X
+
+  shmem_barrier_all();
+
+  free(samples);
+  shmem_free(remote);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
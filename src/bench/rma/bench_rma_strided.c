@@ -0,0 +1,176 @@
+/**
+ * @file bench_rma_strided.c
+ * @brief Strided RMA benchmark comparing shmem_iput<SIZE>/shmem_iget<SIZE>
+ *        against packed contiguous transfers.
+ *
+ * PE 0 moves `count` elements with the same stride on both sides to or from
+ * PE 1, sweeping element size (8 to 128 bits), stride (1 to 64) and
+ * payload (-m to -M bytes). Each strided transfer is compared against the
+ * hand-packed equivalent: pack into a contiguous buffer, shmem_putmem or
+ * shmem_getmem, and unpack. The initiator performs both the pack and the
+ * unpack so that the baseline pays for all of its copies without adding a
+ * synchronization with the target.
+ *
+ * The largest stride spans BENCH_MAX_STRIDE times the largest payload, so
+ * every PE needs (BENCH_MAX_STRIDE + 1) * -M bytes of symmetric heap plus
+ * allocator overhead: 4 MiB for the default -M 64K, 260 MiB for -M 4M.
+ * The header prints the amount for the options given.
+ */
+
+#include <shmem.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+#define BENCH_MAX_STRIDE 64
+
+typedef struct {
+  uint64_t lo;
+  uint64_t hi;
+} bench_uint128_t;
+
+/* Element sizes of the shmem_iput<SIZE>/shmem_iget<SIZE> routines */
+#define BENCH_ISIZE_TABLE(X)                                                   \
+  X(8, uint8_t)                                                                \
+  X(16, uint16_t)                                                              \
+  X(32, uint32_t)                                                              \
+  X(64, uint64_t)                                                              \
+  X(128, bench_uint128_t)
+
+#define BENCH_PRINT_STRIDED(ROUTINE, BITS, STRIDE, COUNT, STRIDED, PACKED)     \
+  do {                                                                         \
+    double bytes = (double)(COUNT) * (BITS) / 8;                               \
+    printf("%-14s %4d %6td %10zu %14.2f %14.2f %8.2f\n", ROUTINE, BITS,        \
+           (ptrdiff_t)(STRIDE), (size_t)(COUNT),                               \
+           bytes / (STRIDED).median / 1e6, bytes / (PACKED).median / 1e6,      \
+           (PACKED).median / (STRIDED).median);                                \
+  } while (0)
+
+#define BENCH_RMA_STRIDED(BITS, TYPE)                                          \
+  do {                                                                         \
+    TYPE *dest = (TYPE *)remote;                                               \
+    TYPE *staging = (TYPE *)remote_staging;                                    \
+    TYPE *src = (TYPE *)local;                                                 \
+    TYPE *packed = (TYPE *)local_packed;                                       \
+    TYPE *unpacked = (TYPE *)local_unpacked;                                   \
+    size_t min_count = opts.min_size / sizeof(TYPE);                           \
+    size_t max_count = opts.max_size / sizeof(TYPE);                           \
+                                                                               \
+    for (ptrdiff_t stride = 1; stride <= BENCH_MAX_STRIDE; stride *= 4) {      \
+      for (size_t count = min_count > 0 ? min_count : 1; count <= max_count;   \
+           count *= 2) {                                                       \
+        size_t bytes = count * sizeof(TYPE);                                   \
+                                                                               \
+        BENCH_TIME_SAMPLES(samples, strided, opts, {                           \
+          shmem_iput##BITS(dest, src, stride, stride, count, peer);            \
+          shmem_quiet();                                                       \
+        });                                                                    \
+        BENCH_TIME_SAMPLES(samples, baseline, opts, {                          \
+          for (size_t i = 0; i < count; i++) {                                 \
+            packed[i] = src[i * stride];                                       \
+          }                                                                    \
+          shmem_putmem(staging, packed, bytes, peer);                          \
+          shmem_quiet();                                                       \
+          for (size_t i = 0; i < count; i++) {                                 \
+            unpacked[i * stride] = packed[i];                                  \
+          }                                                                    \
+        });                                                                    \
+        BENCH_PRINT_STRIDED("shmem_iput" #BITS, BITS, stride, count, strided,  \
+                            baseline);                                         \
+                                                                               \
+        BENCH_TIME_SAMPLES(samples, strided, opts,                             \
+                           shmem_iget##BITS(src, dest, stride, stride, count,  \
+                                            peer));                            \
+        BENCH_TIME_SAMPLES(samples, baseline, opts, {                          \
+          for (size_t i = 0; i < count; i++) {                                 \
+            packed[i] = unpacked[i * stride];                                  \
+          }                                                                    \
+          shmem_getmem(packed, staging, bytes, peer);                          \
+          for (size_t i = 0; i < count; i++) {                                 \
+            src[i * stride] = packed[i];                                       \
+          }                                                                    \
+        });                                                                    \
+        BENCH_PRINT_STRIDED("shmem_iget" #BITS, BITS, stride, count, strided,  \
+                            baseline);                                         \
+      }                                                                        \
+    }                                                                          \
+  } while (0)
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+  opts.iterations = 100;
+  opts.warmup = 10;
+  opts.max_size = 64 * 1024;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("RMA");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  size_t strided_size = opts.max_size * BENCH_MAX_STRIDE;
+  size_t symmetric_size = strided_size + opts.max_size;
+  char *remote = shmem_malloc(strided_size);
+  char *remote_staging = shmem_malloc(opts.max_size);
+  char *local = malloc(strided_size);
+  char *local_packed = malloc(opts.max_size);
+  char *local_unpacked = malloc(strided_size);
+  double *samples = malloc(opts.iterations * sizeof(double));
+  if (remote == NULL || remote_staging == NULL || local == NULL ||
+      local_packed == NULL || local_unpacked == NULL || samples == NULL) {
+    if (mype == 0) {
+      fprintf(stderr,
+              "Could not allocate %zu bytes of symmetric buffers; lower -M "
+              "or raise SHMEM_SYMMETRIC_SIZE above that\n",
+              symmetric_size);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+  memset(remote, 0, strided_size);
+  memset(local, 1, strided_size);
+  memset(local_unpacked, 2, strided_size);
+
+  int peer = 1;
+  bench_stats_t strided, baseline;
+
+  bench_print_header("Strided RMA", &opts,
+                     "routine bits stride count strided_MB_per_s "
+                     "packed_MB_per_s strided_speedup");
+  if (mype == 0) {
+    printf("# symmetric buffers: %zu bytes per PE\n", symmetric_size);
+  }
+  shmem_barrier_all();
+
+  if (mype == 0) {
+#define X(bits, type) BENCH_RMA_STRIDED(bits, type);
+    BENCH_ISIZE_TABLE(X)
+#undef X
+  }
+
+  shmem_barrier_all();
+
+  free(samples);
+  free(local_unpacked);
+  free(local_packed);
+  free(local);
+  shmem_free(remote_staging);
+  shmem_free(remote);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
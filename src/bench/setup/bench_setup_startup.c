@@ -0,0 +1,197 @@
+/**
+ * @file bench_setup_startup.c
+ * @brief Startup and teardown cost benchmark.
+ *
+ * Initialization happens once per process, so this benchmark takes one
+ * measurement per run. It is built once per way of initializing:
+ * bench_setup_startup calls shmem_init, and bench_setup_startup_<level>
+ * calls shmem_init_thread with BENCH_THREAD_LEVEL. Each PE timestamps:
+ *   - process start, from field 22 (starttime) of /proc/self/stat, which
+ *     has clock tick resolution (1 / sysconf(_SC_CLK_TCK), usually 10 ms),
+ *   - entry to main and return from the initialization call,
+ *   - completion of the first and the second shmem_long_p + shmem_quiet to
+ *     the next PE, and of the first shmem_barrier_all,
+ *   - return from shmem_finalize.
+ * Reported per phase are the minimum, mean and maximum over all PEs; the
+ * finalize time can only be reported for PE 0. Run with different PE
+ * counts and SHMEM_SYMMETRIC_SIZE values to see how startup scales.
+ */
+
+#include <shmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+#define BENCH_STRINGIFY(x) #x
+#define BENCH_TO_STRING(x) BENCH_STRINGIFY(x)
+
+typedef enum {
+  BENCH_START_TO_MAIN,
+  BENCH_INIT_CALL,
+  BENCH_START_TO_INIT,
+  BENCH_FIRST_PUT,
+  BENCH_SECOND_PUT,
+  BENCH_FIRST_BARRIER,
+  BENCH_NUM_PHASES
+} bench_phase_t;
+
+static const char *phase_names[BENCH_NUM_PHASES] = {
+    "process_start_to_main", "init_call",        "process_start_to_init",
+    "first_put_quiet",       "second_put_quiet", "first_barrier_all"};
+
+static long target;
+
+/**
+ * @brief Reads the time this process started, on the bench_time() clock.
+ *
+ * A constructor would only run after the dynamic loader and the library
+ * constructors, the OpenSHMEM library's included, so the kernel's record
+ * of the start is used instead: field 22 of /proc/self/stat, in clock
+ * ticks since boot.
+ *
+ * @param start Set to the start time in seconds.
+ * @return True if the start time could be read.
+ */
+static bool read_process_start(double *start) {
+  char line[1024];
+  unsigned long long ticks;
+  struct timespec boot;
+
+  FILE *stat = fopen("/proc/self/stat", "r");
+  if (stat == NULL) {
+    return false;
+  }
+  bool read = fgets(line, sizeof(line), stat) != NULL;
+  fclose(stat);
+
+  /* The command name in field 2 may contain spaces, so skip past its ')' */
+  char *fields = read ? strrchr(line, ')') : NULL;
+  if (fields == NULL ||
+      sscanf(fields + 1,
+             " %*c %*d %*d %*d %*d %*d %*u %*u %*u %*u %*u %*u %*u %*d %*d %*d "
+             "%*d %*d %*d %llu",
+             &ticks) != 1 ||
+      clock_gettime(CLOCK_BOOTTIME, &boot) != 0) {
+    return false;
+  }
+
+  double since_boot = boot.tv_sec + boot.tv_nsec * 1e-9;
+  *start = bench_time() - (since_boot - (double)ticks / sysconf(_SC_CLK_TCK));
+  return true;
+}
+
+/**
+ * @brief Name of a thread level.
+ */
+static const char *thread_level_name(int level) {
+  switch (level) {
+  case SHMEM_THREAD_SINGLE:
+    return "SHMEM_THREAD_SINGLE";
+  case SHMEM_THREAD_FUNNELED:
+    return "SHMEM_THREAD_FUNNELED";
+  case SHMEM_THREAD_SERIALIZED:
+    return "SHMEM_THREAD_SERIALIZED";
+  case SHMEM_THREAD_MULTIPLE:
+    return "SHMEM_THREAD_MULTIPLE";
+  default:
+    return "INVALID";
+  }
+}
+
+int main(int argc, char *argv[]) {
+  double phases[BENCH_NUM_PHASES];
+  double main_entry = bench_time();
+
+#ifdef BENCH_THREAD_LEVEL
+  const char *init_name =
+      "shmem_init_thread(" BENCH_TO_STRING(BENCH_THREAD_LEVEL) ")";
+  int provided;
+  shmem_init_thread(BENCH_THREAD_LEVEL, &provided);
+#else
+  const char *init_name = "shmem_init()";
+  int provided = -1;
+  shmem_init();
+#endif
+  double init_return = bench_time();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  int peer = (mype + 1) % npes;
+
+  shmem_long_p(&target, mype, peer);
+  shmem_quiet();
+  double first_put = bench_time();
+  shmem_long_p(&target, mype, peer);
+  shmem_quiet();
+  double second_put = bench_time();
+  shmem_barrier_all();
+  double first_barrier = bench_time();
+
+  /* Every PE must take part in the reductions of every phase */
+  double process_start = 0.0;
+  bool have_start = read_process_start(&process_start);
+  have_start = bench_max_across_pes(!have_start) == 0;
+
+  phases[BENCH_START_TO_MAIN] = main_entry - process_start;
+  phases[BENCH_INIT_CALL] = init_return - main_entry;
+  phases[BENCH_START_TO_INIT] = init_return - process_start;
+  phases[BENCH_FIRST_PUT] = first_put - init_return;
+  phases[BENCH_SECOND_PUT] = second_put - first_put;
+  phases[BENCH_FIRST_BARRIER] = first_barrier - second_put;
+
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  const char *heap_size = getenv("SHMEM_SYMMETRIC_SIZE");
+
+  if (mype == 0) {
+    printf("# Startup and teardown cost\n");
+    printf("# PEs: %d, init: %s", npes, init_name);
+    if (provided >= 0) {
+      printf(", provided: %s", thread_level_name(provided));
+    }
+    printf("\n# SHMEM_SYMMETRIC_SIZE: %s\n",
+           heap_size != NULL ? heap_size : "(default)");
+    if (have_start) {
+      printf("# process start resolution: %.3f ms\n",
+             1e3 / sysconf(_SC_CLK_TCK));
+    } else {
+      printf("# process start unavailable from /proc/self/stat\n");
+    }
+    printf("# phase min_ms mean_ms max_ms\n");
+  }
+
+  for (int p = 0; p < BENCH_NUM_PHASES; p++) {
+    bool from_start = p == BENCH_START_TO_MAIN || p == BENCH_START_TO_INIT;
+    if (from_start && !have_start) {
+      continue;
+    }
+    double min = -bench_max_across_pes(-phases[p]);
+    double max = bench_max_across_pes(phases[p]);
+    double mean = bench_sum_across_pes(phases[p]) / npes;
+    if (mype == 0) {
+      printf("%-24s %12.3f %12.3f %12.3f\n", phase_names[p], min * 1e3,
+             mean * 1e3, max * 1e3);
+    }
+  }
+
+  shmem_barrier_all();
+
+  double finalize_start = bench_time();
+  shmem_finalize();
+  double finalize_end = bench_time();
+
+  if (mype == 0) {
+    printf("# shmem_finalize on PE 0: %.3f ms\n",
+           (finalize_end - finalize_start) * 1e3);
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,211 @@
+/**
+ * @file bench_signaling_put_signal.c
+ * @brief Put-with-signal latency and streaming benchmark.
+ *
+ * Latency: PE 0 and PE 1 ping-pong a message, each side blocked in
+ * shmem_signal_wait_until() until the other's message arrives. Messages are
+ * sent with shmem_putmem_signal() using SHMEM_SIGNAL_SET or
+ * SHMEM_SIGNAL_ADD, or with the classic shmem_putmem() + shmem_fence() +
+ * shmem_uint64_atomic_set() emulation. Reported latencies are one way,
+ * half of each round trip.
+ *
+ * Streaming: PE 0 sends -W chunks per sample, each signalled on its own,
+ * and PE 1 acknowledges once it has seen the last one. Chunks are sent with
+ * shmem_putmem_signal_nbi() and SHMEM_SIGNAL_ADD, or with the emulation
+ * using shmem_putmem_nbi().
+ */
+
+#include <shmem.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+typedef enum {
+  BENCH_SIGNAL_SET,
+  BENCH_SIGNAL_ADD,
+  BENCH_SIGNAL_EMULATED,
+  BENCH_NUM_SIGNAL_MODES
+} bench_signal_mode_t;
+
+static const char *latency_names[BENCH_NUM_SIGNAL_MODES] = {
+    "shmem_putmem_signal(SET)", "shmem_putmem_signal(ADD)",
+    "shmem_putmem+fence+atomic_set"};
+
+static const char *streaming_names[BENCH_NUM_SIGNAL_MODES] = {
+    NULL, "shmem_putmem_signal_nbi(ADD)",
+    "shmem_putmem_nbi+fence+atomic_set"};
+
+static char *remote;
+static char *local;
+static uint64_t *sig_addr;
+static uint64_t *ack;
+static uint64_t ack_round;
+
+/**
+ * @brief Sends one signalled message and counts the signal it carries.
+ *
+ * With SHMEM_SIGNAL_SET and the emulation, the signal is set to the
+ * message's sequence number; with SHMEM_SIGNAL_ADD, it is incremented. In
+ * all cases the receiver's signal reaches `*sent` once the message arrives.
+ *
+ * @param mode How to signal the message.
+ * @param nbi True to send the data with a non-blocking put.
+ * @param dest Remote destination of the data.
+ * @param size Message size in bytes.
+ * @param sent Sequence number of the last message sent; incremented.
+ * @param peer Receiving PE.
+ */
+static void send_signalled(bench_signal_mode_t mode, bool nbi, void *dest,
+                           size_t size, uint64_t *sent, int peer) {
+  uint64_t seq = ++*sent;
+
+  switch (mode) {
+  case BENCH_SIGNAL_SET:
+  case BENCH_SIGNAL_ADD: {
+    int sig_op = mode == BENCH_SIGNAL_SET ? SHMEM_SIGNAL_SET : SHMEM_SIGNAL_ADD;
+    uint64_t value = mode == BENCH_SIGNAL_SET ? seq : 1;
+    if (nbi) {
+      shmem_putmem_signal_nbi(dest, local, size, sig_addr, value, sig_op, peer);
+    } else {
+      shmem_putmem_signal(dest, local, size, sig_addr, value, sig_op, peer);
+    }
+    break;
+  }
+  default:
+    if (nbi) {
+      shmem_putmem_nbi(dest, local, size, peer);
+    } else {
+      shmem_putmem(dest, local, size, peer);
+    }
+    shmem_fence();
+    shmem_uint64_atomic_set(sig_addr, seq, peer);
+    break;
+  }
+}
+
+/**
+ * @brief Clears the signals and sequence numbers between measurements.
+ */
+static void reset_signals(void) {
+  shmem_barrier_all();
+  *sig_addr = 0;
+  *ack = 0;
+  ack_round = 0;
+  shmem_barrier_all();
+}
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("SIGNALING");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  remote = shmem_malloc(opts.max_size);
+  sig_addr = shmem_malloc(sizeof(uint64_t));
+  ack = shmem_malloc(sizeof(uint64_t));
+  local = malloc(opts.max_size);
+  double *samples = malloc(opts.iterations * sizeof(double));
+  if (remote == NULL || sig_addr == NULL || ack == NULL || local == NULL ||
+      samples == NULL) {
+    if (mype == 0) {
+      fprintf(stderr, "Could not allocate %zu byte buffers\n", opts.max_size);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+  memset(local, 1, opts.max_size);
+
+  bool active = mype < 2;
+  int peer = 1 - mype;
+  bench_stats_t stats;
+
+  bench_print_header("Put-with-signal latency", &opts,
+                     "routine bytes median_us p99_us");
+
+  for (int mode = 0; mode < BENCH_NUM_SIGNAL_MODES; mode++) {
+    for (size_t size = opts.min_size; size <= opts.max_size; size *= 2) {
+      uint64_t sent = 0;
+      reset_signals();
+
+      if (active) {
+        BENCH_TIME_SAMPLES(samples, stats, opts, {
+          if (mype == 0) {
+            send_signalled(mode, false, remote, size, &sent, peer);
+            shmem_signal_wait_until(sig_addr, SHMEM_CMP_GE, sent);
+          } else {
+            shmem_signal_wait_until(sig_addr, SHMEM_CMP_GE, sent + 1);
+            send_signalled(mode, false, remote, size, &sent, peer);
+          }
+        });
+
+        stats.median /= 2;
+        stats.p99 /= 2;
+        bench_print_latency(latency_names[mode], size, &stats);
+      }
+    }
+  }
+
+  if (mype == 0) {
+    printf("\n");
+  }
+  bench_print_header("Put-with-signal streaming", &opts,
+                     "routine chunk_bytes chunks MB_per_s");
+
+  for (int mode = BENCH_SIGNAL_ADD; mode < BENCH_NUM_SIGNAL_MODES; mode++) {
+    size_t max_chunk = opts.max_size / opts.max_window;
+    for (size_t size = opts.min_size; size <= max_chunk; size *= 2) {
+      uint64_t sent = 0;
+      reset_signals();
+
+      if (active) {
+        BENCH_TIME_SAMPLES(samples, stats, opts, {
+          ack_round++;
+          if (mype == 0) {
+            for (int c = 0; c < opts.max_window; c++) {
+              send_signalled(mode, true, remote + c * size, size, &sent, peer);
+            }
+            shmem_uint64_wait_until(ack, SHMEM_CMP_GE, ack_round);
+          } else {
+            sent += opts.max_window;
+            shmem_signal_wait_until(sig_addr, SHMEM_CMP_GE, sent);
+            shmem_uint64_atomic_set(ack, ack_round, peer);
+          }
+        });
+
+        if (mype == 0) {
+          printf("%-36s %10zu %6d %12.2f\n", streaming_names[mode], size,
+                 opts.max_window,
+                 (double)size * opts.max_window / stats.median / 1e6);
+        }
+      }
+    }
+  }
+
+  shmem_barrier_all();
+
+  free(samples);
+  free(local);
+  shmem_free(ack);
+  shmem_free(sig_addr);
+  shmem_free(remote);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
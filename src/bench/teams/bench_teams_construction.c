@@ -0,0 +1,246 @@
+/**
+ * @file bench_teams_construction.c
+ * @brief Team construction and translation cost benchmark.
+ *
+ * Split latency: times shmem_team_split_strided of the first 2, 4, ...
+ * PEs of SHMEM_TEAM_WORLD (and all of them), shmem_team_split_2d of
+ * SHMEM_TEAM_WORLD for x ranges of 1, 2, 4, ... PEs, and the
+ * shmem_team_destroy of each new team. The reported median and p99 are the
+ * largest over all PEs.
+ *
+ * Churn: creates up to 256 teams back to back, stopping at the first
+ * failed split, then destroys them all, and reports the total and
+ * per-team time.
+ *
+ * Queries: per-call cost of shmem_team_my_pe, shmem_team_n_pes and
+ * shmem_team_translate_pe, timed over 1000 calls per sample on
+ * SHMEM_TEAM_WORLD and on a team of the even PEs.
+ */
+
+#include <shmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+#define BENCH_CHURN_TEAMS 256
+#define BENCH_CALLS_PER_SAMPLE 1000
+
+typedef enum {
+  BENCH_MY_PE,
+  BENCH_N_PES,
+  BENCH_TRANSLATE_PE,
+  BENCH_NUM_QUERIES
+} bench_query_t;
+
+static const char *query_names[BENCH_NUM_QUERIES] = {
+    "shmem_team_my_pe", "shmem_team_n_pes", "shmem_team_translate_pe"};
+
+static volatile int sink;
+
+/**
+ * @brief Prints the largest median and p99 over all PEs of a set of
+ *        samples. Collective.
+ */
+static void print_max_latency(const char *routine, size_t value,
+                              double *samples, int count) {
+  bench_stats_t stats;
+  bench_compute_stats(samples, count, &stats);
+  stats.median = bench_max_across_pes(stats.median);
+  stats.p99 = bench_max_across_pes(stats.p99);
+  bench_print_latency(routine, value, &stats);
+}
+
+/**
+ * @brief Times splits of SHMEM_TEAM_WORLD and destroys of the new teams.
+ *
+ * @param split_2d True for shmem_team_split_2d with an x range of `param`,
+ *                 false for shmem_team_split_strided of the first `param`
+ *                 PEs.
+ * @param param Team size or x range.
+ * @param opts Iterations and warmup.
+ * @param split_samples Split times.
+ * @param destroy_samples Destroy times; zero on PEs outside the new team.
+ */
+static void time_split(bool split_2d, int param, const bench_options_t *opts,
+                       double *split_samples, double *destroy_samples) {
+  for (int i = -opts->warmup; i < opts->iterations; i++) {
+    shmem_team_t team = SHMEM_TEAM_INVALID, other = SHMEM_TEAM_INVALID;
+
+    shmem_barrier_all();
+    double start = bench_time();
+    if (split_2d) {
+      shmem_team_split_2d(SHMEM_TEAM_WORLD, param, NULL, 0, &team, NULL, 0,
+                          &other);
+    } else {
+      shmem_team_split_strided(SHMEM_TEAM_WORLD, 0, 1, param, NULL, 0, &team);
+    }
+    double split = bench_time();
+
+    if (team != SHMEM_TEAM_INVALID) {
+      shmem_team_destroy(team);
+    }
+    if (other != SHMEM_TEAM_INVALID) {
+      shmem_team_destroy(other);
+    }
+    double destroyed = bench_time();
+
+    if (i >= 0) {
+      split_samples[i] = split - start;
+      destroy_samples[i] = destroyed - split;
+    }
+  }
+}
+
+/**
+ * @brief Runs BENCH_CALLS_PER_SAMPLE calls of a team query.
+ */
+static void run_queries(bench_query_t query, shmem_team_t team, int team_pes) {
+  int result = 0;
+
+  for (int c = 0; c < BENCH_CALLS_PER_SAMPLE; c++) {
+    switch (query) {
+    case BENCH_MY_PE:
+      result += shmem_team_my_pe(team);
+      break;
+    case BENCH_N_PES:
+      result += shmem_team_n_pes(team);
+      break;
+    default:
+      result += shmem_team_translate_pe(team, c % team_pes, SHMEM_TEAM_WORLD);
+      break;
+    }
+  }
+  sink = result;
+}
+
+int main(int argc, char *argv[]) {
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+  opts.iterations = 100;
+  opts.warmup = 10;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("TEAMS");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  double *split_samples = malloc(opts.iterations * sizeof(double));
+  double *destroy_samples = malloc(opts.iterations * sizeof(double));
+  shmem_team_t *churn = malloc(BENCH_CHURN_TEAMS * sizeof(shmem_team_t));
+  if (split_samples == NULL || destroy_samples == NULL || churn == NULL) {
+    shmem_global_exit(EXIT_FAILURE);
+  }
+
+  bench_print_header("Team split latency", &opts,
+                     "routine team_pes_or_xrange median_us p99_us");
+
+  /* Doubling team sizes, ending with all PEs */
+  for (int size = 2; size < 2 * npes; size *= 2) {
+    int team_pes = size < npes ? size : npes;
+    time_split(false, team_pes, &opts, split_samples, destroy_samples);
+    print_max_latency("shmem_team_split_strided", team_pes, split_samples,
+                      opts.iterations);
+    print_max_latency("shmem_team_destroy", team_pes, destroy_samples,
+                      opts.iterations);
+  }
+
+  for (int xrange = 1; xrange <= npes; xrange *= 2) {
+    time_split(true, xrange, &opts, split_samples, destroy_samples);
+    print_max_latency("shmem_team_split_2d", xrange, split_samples,
+                      opts.iterations);
+    print_max_latency("shmem_team_destroy(2d)", xrange, destroy_samples,
+                      opts.iterations);
+  }
+
+  /* Churn: many live teams at once, as when building a team hierarchy */
+  shmem_barrier_all();
+  int created = 0;
+  double start = bench_time();
+  while (created < BENCH_CHURN_TEAMS &&
+         shmem_team_split_strided(SHMEM_TEAM_WORLD, 0, 1, npes, NULL, 0,
+                                  &churn[created]) == 0) {
+    created++;
+  }
+  double split = bench_time();
+  for (int t = 0; t < created; t++) {
+    shmem_team_destroy(churn[t]);
+  }
+  double destroyed = bench_time();
+
+  double split_time = bench_max_across_pes(split - start);
+  double destroy_time = bench_max_across_pes(destroyed - split);
+  if (mype == 0) {
+    printf("\n# Team churn\n");
+    printf("# routine teams total_ms per_team_us\n");
+    if (created > 0) {
+      printf("%-28s %8d %12.3f %12.3f\n", "shmem_team_split_strided",
+             created, split_time * 1e3, split_time / created * 1e6);
+      printf("%-28s %8d %12.3f %12.3f\n", "shmem_team_destroy", created,
+             destroy_time * 1e3, destroy_time / created * 1e6);
+    }
+    if (created < BENCH_CHURN_TEAMS) {
+      printf("# split %d failed, no more teams could be created\n",
+             created + 1);
+    }
+    printf("\n");
+  }
+
+  shmem_team_t even = SHMEM_TEAM_INVALID;
+  shmem_team_split_strided(SHMEM_TEAM_WORLD, 0, 2, (npes + 1) / 2, NULL, 0,
+                           &even);
+
+  bench_print_header("Team query cost", &opts, "routine team ns_per_call");
+  if (mype == 0) {
+    printf("# calls per sample: %d\n", BENCH_CALLS_PER_SAMPLE);
+  }
+
+  shmem_team_t teams[2] = {SHMEM_TEAM_WORLD, even};
+  const char *team_names[2] = {"world", "even"};
+  bench_stats_t stats;
+
+  for (int t = 0; t < 2; t++) {
+    /* Odd PEs are outside the even team and time nothing */
+    bool member = teams[t] != SHMEM_TEAM_INVALID;
+    int team_pes = member ? shmem_team_n_pes(teams[t]) : 0;
+
+    for (int q = 0; q < BENCH_NUM_QUERIES; q++) {
+      double median = 0.0;
+      if (member) {
+        BENCH_TIME_SAMPLES(split_samples, stats, opts,
+                           run_queries(q, teams[t], team_pes));
+        median = stats.median;
+      }
+
+      double per_call = bench_max_across_pes(median) / BENCH_CALLS_PER_SAMPLE;
+      if (mype == 0) {
+        printf("%-28s %6s %12.2f\n", query_names[q], team_names[t],
+               per_call * 1e9);
+      }
+    }
+  }
+
+  shmem_barrier_all();
+
+  if (even != SHMEM_TEAM_INVALID) {
+    shmem_team_destroy(even);
+  }
+  free(churn);
+  free(destroy_samples);
+  free(split_samples);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,238 @@
+/**
+ * @file bench_threads_ctx_throughput.c
+ * @brief Multi-threaded, multi-context RMA and AMO throughput benchmark.
+ *
+ * Initializes with SHMEM_THREAD_MULTIPLE and runs 1 to -t (default 4)
+ * pthreads per PE, doubling. Each thread issues windows of -W
+ * shmem_ctx_long_p or shmem_ctx_long_atomic_add operations to its own
+ * words on the next PE, each window followed by shmem_ctx_quiet, on:
+ *   - SHMEM_CTX_DEFAULT,
+ *   - one context shared by all threads of the PE,
+ *   - one SHMEM_CTX_PRIVATE context per thread, created by that thread.
+ * Contexts are created and destroyed outside the timed region. Reported
+ * are the aggregate operations per second over all PEs and the scaling
+ * efficiency: that rate over the single-thread rate times the number of
+ * threads. Efficiency well below 1 on shared contexts and close to 1 on
+ * private ones means the private contexts remove lock contention.
+ */
+
+#include <pthread.h>
+#include <shmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "bench.h"
+#include "shmemvv.h"
+
+typedef enum {
+  BENCH_CTX_DEFAULT,
+  BENCH_CTX_SHARED,
+  BENCH_CTX_PRIVATE,
+  BENCH_NUM_CTX_MODES
+} bench_ctx_mode_t;
+
+typedef enum { BENCH_P, BENCH_ATOMIC_ADD, BENCH_NUM_OPS } bench_op_t;
+
+static const char *ctx_mode_names[BENCH_NUM_CTX_MODES] = {"default", "shared",
+                                                          "private"};
+
+static const char *op_names[BENCH_NUM_OPS] = {"shmem_ctx_long_p",
+                                              "shmem_ctx_long_atomic_add"};
+
+/**
+  @brief Work description of one thread
+ */
+typedef struct {
+  int thread;                  /**< Index of the thread on its PE */
+  bench_ctx_mode_t mode;       /**< Context the thread issues on */
+  bench_op_t op;               /**< Operation the thread issues */
+  shmem_ctx_t shared;          /**< Context of BENCH_CTX_SHARED */
+  pthread_barrier_t *start;    /**< Releases all threads at once */
+  const bench_options_t *opts; /**< Iterations, warmup and window */
+  long *buffer;                /**< Symmetric target buffer */
+  int peer;                    /**< Target PE */
+  bool fallback;               /**< Set if the private context failed */
+  double begin;                /**< Time the first window started */
+  double end;                  /**< Time the last window completed */
+} bench_thread_args_t;
+
+/**
+ * @brief Issues one window of operations on a context and waits for them.
+ */
+static void run_window(shmem_ctx_t ctx, bench_op_t op, long *target,
+                       int window, int peer) {
+  for (int i = 0; i < window; i++) {
+    if (op == BENCH_P) {
+      shmem_ctx_long_p(ctx, &target[i], i, peer);
+    } else {
+      shmem_ctx_long_atomic_add(ctx, &target[i], 1, peer);
+    }
+  }
+  shmem_ctx_quiet(ctx);
+}
+
+/**
+ * @brief Thread body: warms up, waits for the start barrier, then issues
+ *        the timed windows.
+ */
+static void *run_thread(void *arg) {
+  bench_thread_args_t *args = arg;
+  const bench_options_t *opts = args->opts;
+  long *target = args->buffer + (size_t)args->thread * opts->max_window;
+  shmem_ctx_t ctx = SHMEM_CTX_DEFAULT;
+
+  if (args->mode == BENCH_CTX_SHARED) {
+    ctx = args->shared;
+  } else if (args->mode == BENCH_CTX_PRIVATE) {
+    if (shmem_ctx_create(SHMEM_CTX_PRIVATE, &ctx) != 0) {
+      ctx = SHMEM_CTX_DEFAULT;
+      args->fallback = true;
+    }
+  }
+
+  for (int i = 0; i < opts->warmup; i++) {
+    run_window(ctx, args->op, target, opts->max_window, args->peer);
+  }
+
+  pthread_barrier_wait(args->start);
+  args->begin = bench_time();
+
+  for (int i = 0; i < opts->iterations; i++) {
+    run_window(ctx, args->op, target, opts->max_window, args->peer);
+  }
+  args->end = bench_time();
+
+  if (args->mode == BENCH_CTX_PRIVATE && !args->fallback) {
+    shmem_ctx_destroy(ctx);
+  }
+  return NULL;
+}
+
+int main(int argc, char *argv[]) {
+  int provided;
+  shmem_init_thread(SHMEM_THREAD_MULTIPLE, &provided);
+
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+  bench_options_t opts = BENCH_DEFAULT_OPTIONS;
+  opts.iterations = 100;
+  opts.warmup = 10;
+  opts.max_threads = 4;
+
+  if (!bench_parse_args(argc, argv, &opts)) {
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  if (npes < 2) {
+    if (mype == 0) {
+      display_not_enough_pes("THREADS");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  if (provided != SHMEM_THREAD_MULTIPLE) {
+    if (mype == 0) {
+      printf("# SHMEM_THREAD_MULTIPLE is not provided, skipping\n");
+    }
+    shmem_finalize();
+    return EXIT_SUCCESS;
+  }
+
+  long *buffer = shmem_calloc((size_t)opts.max_threads * opts.max_window,
+                              sizeof(long));
+  pthread_t *threads = malloc(opts.max_threads * sizeof(pthread_t));
+  bench_thread_args_t *args =
+      malloc(opts.max_threads * sizeof(bench_thread_args_t));
+  if (buffer == NULL || threads == NULL || args == NULL) {
+    if (mype == 0) {
+      fprintf(stderr, "Could not allocate buffers for %d threads\n",
+              opts.max_threads);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+
+  shmem_ctx_t shared = SHMEM_CTX_DEFAULT;
+  bool have_shared = shmem_ctx_create(0, &shared) == 0;
+
+  bench_print_header("Multi-threaded context throughput", &opts,
+                     "routine ctx threads Mops_per_s efficiency");
+  if (mype == 0) {
+    printf("# window: %d\n", opts.max_window);
+    if (!have_shared) {
+      printf("# shmem_ctx_create failed, shared rows use the default "
+             "context\n");
+    }
+  }
+
+  for (int op = 0; op < BENCH_NUM_OPS; op++) {
+    for (int mode = 0; mode < BENCH_NUM_CTX_MODES; mode++) {
+      double single_rate = 0.0;
+
+      for (int nthreads = 1; nthreads <= opts.max_threads; nthreads *= 2) {
+        pthread_barrier_t start;
+        pthread_barrier_init(&start, NULL, nthreads + 1);
+
+        shmem_barrier_all();
+
+        for (int t = 0; t < nthreads; t++) {
+          args[t] = (bench_thread_args_t){.thread = t,
+                                          .mode = mode,
+                                          .op = op,
+                                          .shared = shared,
+                                          .start = &start,
+                                          .opts = &opts,
+                                          .buffer = buffer,
+                                          .peer = (mype + 1) % npes,
+                                          .fallback = false,
+                                          .begin = 0.0,
+                                          .end = 0.0};
+          pthread_create(&threads[t], NULL, run_thread, &args[t]);
+        }
+
+        pthread_barrier_wait(&start);
+        bool fallback = false;
+        double begin = 0.0, end = 0.0;
+        for (int t = 0; t < nthreads; t++) {
+          pthread_join(threads[t], NULL);
+          begin = t == 0 || args[t].begin < begin ? args[t].begin : begin;
+          end = args[t].end > end ? args[t].end : end;
+          fallback = fallback || args[t].fallback;
+        }
+        double elapsed = end - begin;
+
+        pthread_barrier_destroy(&start);
+
+        double ops = (double)nthreads * opts.iterations * opts.max_window;
+        double rate = bench_sum_across_pes(ops / elapsed);
+        if (nthreads == 1) {
+          single_rate = rate;
+        }
+        bool any_fallback = bench_max_across_pes(fallback) > 0;
+
+        if (mype == 0) {
+          printf("%-28s %8s %8d %14.3f %12.3f\n", op_names[op],
+                 ctx_mode_names[mode], nthreads, rate / 1e6,
+                 rate / (nthreads * single_rate));
+          if (any_fallback) {
+            printf("# shmem_ctx_create(SHMEM_CTX_PRIVATE) failed on some "
+                   "threads, which used the default context\n");
+          }
+        }
+      }
+    }
+  }
+
+  shmem_barrier_all();
+
+  if (have_shared) {
+    shmem_ctx_destroy(shared);
+  }
+  free(args);
+  free(threads);
+  shmem_free(buffer);
+
+  shmem_finalize();
+  return EXIT_SUCCESS;
+}
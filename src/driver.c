@@ -0,0 +1,64 @@
+/**
+ * @file driver.c
+ * @brief Single-launch category driver.
+ *
+ * Runs every test of a category in one launched job: the driver calls
+ * shmem_init() once, then each test's renamed `main()` in turn with a
+ * barrier on either side, and reduces the exit codes across PEs so a test
+ * that fails on any PE is reported once by PE 0.
+ */
+
+#include <shmem.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "driver.h"
+#include "driver_tests.h"
+
+#define X(name) int name##_main(int argc, char *argv[]);
+SHMEMVV_DRIVER_TEST_TABLE(X)
+#undef X
+
+typedef struct {
+  const char *name;
+  shmemvv_test_main_t entry;
+} driver_test_t;
+
+static const driver_test_t driver_tests[] = {
+#define X(name) {#name, name##_main},
+    SHMEMVV_DRIVER_TEST_TABLE(X)
+#undef X
+};
+
+int main(int argc, char *argv[]) {
+  static int test_rc, max_rc;
+
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int ntests = sizeof(driver_tests) / sizeof(driver_tests[0]);
+  int nfailed = 0;
+
+  for (int i = 0; i < ntests; i++) {
+    shmem_barrier_all();
+    test_rc = driver_tests[i].entry(argc, argv) == EXIT_SUCCESS ? 0 : 1;
+    shmem_barrier_all();
+
+    shmem_int_max_reduce(SHMEM_TEAM_WORLD, &max_rc, &test_rc, 1);
+    if (max_rc != 0) {
+      nfailed++;
+      if (mype == 0) {
+        fprintf(stderr, "Driver: %s exited with an error on at least one PE\n",
+                driver_tests[i].name);
+      }
+    }
+  }
+
+  if (mype == 0) {
+    printf("Driver: %d of %d test programs exited successfully\n",
+           ntests - nfailed, ntests);
+  }
+
+  shmem_finalize();
+  return nfailed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
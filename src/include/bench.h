@@ -0,0 +1,129 @@
+/**
+ * @file bench.h
+ * @brief Shared helpers for the performance benchmarks.
+ *
+ * The benchmarks live in src/bench/<category>/ and are built into
+ * bin/bench/<category>/. Each one parses the common options with
+ * bench_parse_args(), times samples with BENCH_TIME_SAMPLES() and prints
+ * its results from PE 0 as whitespace-separated columns under a `#` header.
+ */
+
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <shmem.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+  @brief Options shared by all benchmarks; each benchmark sets its own
+         defaults before calling bench_parse_args()
+ */
+typedef struct {
+  int iterations;  /**< Timed samples per measurement (-i) */
+  int warmup;      /**< Untimed iterations before the samples (-w) */
+  size_t min_size; /**< Smallest message size in bytes (-m) */
+  size_t max_size; /**< Largest message size in bytes (-M) */
+  int max_window;  /**< Largest number of outstanding operations (-W) */
+  int max_threads; /**< Largest number of threads per PE (-t) */
+  double duration; /**< Seconds per time-limited measurement (-d) */
+} bench_options_t;
+
+#define BENCH_DEFAULT_OPTIONS                                                  \
+  { 1000, 100, 1, 4 * 1024 * 1024, 64, 1, 1.0 }
+
+/**
+  @brief Summary of a set of timed samples, in seconds
+ */
+typedef struct {
+  double min;
+  double median;
+  double p99;
+  double max;
+  double mean;
+} bench_stats_t;
+
+/**
+  @brief Parses the common benchmark options
+  @param argc Argument count passed to main()
+  @param argv Arguments passed to main()
+  @param opts Defaults on entry, parsed options on return
+  @return True if the options are valid; on false, PE 0 has printed usage
+ */
+bool bench_parse_args(int argc, char *argv[], bench_options_t *opts);
+
+/**
+  @brief Current time of the monotonic clock
+  @return Time in seconds
+ */
+double bench_time(void);
+
+/**
+  @brief Summarizes timed samples
+  @param samples Samples in seconds; sorted in place
+  @param count Number of samples
+  @param stats Summary of the samples
+ */
+void bench_compute_stats(double *samples, int count, bench_stats_t *stats);
+
+/**
+  @brief Sums a value over all PEs; every PE must call this function
+  @param value This PE's value
+  @return Sum of the values of all PEs
+ */
+double bench_sum_across_pes(double value);
+
+/**
+  @brief Largest value over all PEs; every PE must call this function
+  @param value This PE's value
+  @return Largest of the values of all PEs
+ */
+double bench_max_across_pes(double value);
+
+/**
+  @brief Prints a benchmark's `#` header lines on PE 0
+  @param title Name of the benchmark
+  @param opts Options the benchmark runs with
+  @param columns Column names of the rows that follow
+ */
+void bench_print_header(const char *title, const bench_options_t *opts,
+                        const char *columns);
+
+/**
+  @brief Prints a latency row on PE 0: routine, message size in bytes, and
+         the median and 99th percentile of the samples in microseconds
+  @param routine Name of the timed routine
+  @param bytes Message size in bytes
+  @param stats Summary of the timed samples
+ */
+void bench_print_latency(const char *routine, size_t bytes,
+                         const bench_stats_t *stats);
+
+/**
+  @brief Runs STMT `opts.warmup` times untimed, then `opts.iterations`
+         times timing each run into `samples`, and summarizes the samples
+         into `stats`
+ */
+#define BENCH_TIME_SAMPLES(samples, stats, opts, STMT)                         \
+  do {                                                                         \
+    for (int bench_i = -(opts).warmup; bench_i < (opts).iterations;            \
+         bench_i++) {                                                          \
+      double bench_start = bench_time();                                       \
+      STMT;                                                                    \
+      double bench_end = bench_time();                                         \
+      if (bench_i >= 0) {                                                      \
+        (samples)[bench_i] = bench_end - bench_start;                          \
+      }                                                                        \
+    }                                                                          \
+    bench_compute_stats((samples), (opts).iterations, &(stats));               \
+  } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_H */
@@ -0,0 +1,39 @@
+/**
+ * @file driver.h
+ * @brief Support for the single-launch category drivers and test modules.
+ *
+ * A category driver links the bodies of every test in a category into one
+ * executable; a test module is one test built as a shared object for
+ * shmemvv_runner to dlopen. Either way the test's `main()` is renamed
+ * (`<test>_main()` in a driver, `run()` in a module) and its calls to
+ * `shmem_init()`/`shmem_finalize()` are redirected to the no-op hooks below,
+ * so the driver or runner owns the one real initialization.
+ */
+
+#ifndef DRIVER_H
+#define DRIVER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+  @brief Entry point of a test linked into a category driver or module
+ */
+typedef int (*shmemvv_test_main_t)(int argc, char *argv[]);
+
+/**
+  @brief Stand-in for shmem_init() inside a test run by a driver or runner
+ */
+void shmemvv_driver_init(void);
+
+/**
+  @brief Stand-in for shmem_finalize() inside a test run by a driver or runner
+ */
+void shmemvv_driver_finalize(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DRIVER_H */
@@ -8,6 +8,7 @@ extern "C" {
 #include <string.h>
 #include <stdio.h>
 #include <stdarg.h>
+#include <stdbool.h>
 #include <errno.h>
 #include <time.h>
 #include <shmem.h>
@@ -17,6 +18,19 @@ extern "C" {
 
 #define MAX_LOG_LEN 512
 
+/* Compile-time log levels. Messages less severe than SHMEMVV_LOG_LEVEL are
+ * compiled out of the tests entirely, arguments included. Defaults to INFO,
+ * which _DEBUG_ and _VERBOSE_ builds always use.
+ */
+#define SHMEMVV_LOG_LEVEL_FAIL 0
+#define SHMEMVV_LOG_LEVEL_WARN 1
+#define SHMEMVV_LOG_LEVEL_INFO 2
+
+#if !defined(SHMEMVV_LOG_LEVEL) || defined(_DEBUG_) || defined(_VERBOSE_)
+#undef SHMEMVV_LOG_LEVEL
+#define SHMEMVV_LOG_LEVEL SHMEMVV_LOG_LEVEL_INFO
+#endif
+
 /* Your step-by-step guide to adding logging to a test:
  * 1. Call once, `log_init(__FILE__)` after `shmem_init()`.
  * 2. Call `log_routine("shmem_routine_im_testing_and_
@@ -27,6 +41,24 @@ extern "C" {
  *    `shmem_finalize()`.
  *
  * Logs will be placed into env(SHMEMVV_LOG_DIR) or /tmp if unset.
+ *
+ * Setting env(SHMEMVV_LOG_BUFFER) to a record count keeps the most recent
+ * records in memory instead of writing each one as it is logged. The
+ * buffer is written out by `log_fail()`, `log_flush()` and `log_close()`.
+ *
+ * The log file is block buffered. It is flushed by `log_fail()`,
+ * `log_flush()`, `log_close()` and on exit(), e.g. from shmem_global_exit().
+ * Setting env(SHMEMVV_LOG_FLUSH) to 1 also flushes it after every record,
+ * so the log of a job that is killed ends at its last record.
+ *
+ * Setting env(SHMEMVV_LOG_FORMAT) to "jsonl" writes <test>.peNN.jsonl
+ * instead, one JSON object per record with the wall clock time, PE, level,
+ * current routine and message. scripts/merge_logs.sh merges the logs of all
+ * PEs into one timeline.
+ *
+ * Each `log_routine()` section is also timed. `check_test_result()` reduces
+ * the timings across PEs and, if env(SHMEMVV_RESULTS_FILE) is set, PE 0
+ * appends one JSON record per section to that file.
  */
 
 /**
@@ -66,12 +98,64 @@ void log_warn(const char *fstring, ...);
  */
 void log_fail(const char *fstring, ...);
 
+/**
+   Writes any buffered log records to the log file and flushes it.
+ */
+void log_flush(void);
+
+/**
+  @brief Wall time spent in one log_routine() section on this PE.
+ */
+typedef struct {
+  char routine[MAX_LOG_LEN];
+  double seconds;
+} log_timing_t;
+
+/**
+   Ends the current log_routine() section and hands over the timings of
+   all sections since the last call.
+
+   @param timings Set to the timings, valid until the next call.
+   @return The number of timings.
+ */
+int log_take_timings(log_timing_t **timings);
+
+/**
+   Appends a timing record to env(SHMEMVV_RESULTS_FILE), if set.
+
+   @param result_name Name the test result was displayed under.
+   @param passed True if the test passed on every PE.
+   @param timing Routine and the mean time across PEs.
+   @param npes Number of PEs the times were taken on.
+   @param min_seconds Shortest time on any PE.
+   @param max_seconds Longest time on any PE.
+ */
+void log_result_record(const char *result_name, bool passed,
+                       const log_timing_t *timing, int npes,
+                       double min_seconds, double max_seconds);
+
 void log_init(const char *test_name);
 
 void log_routine(const char *routine);
 
 void log_close(int result);
 
+#if SHMEMVV_LOG_LEVEL < SHMEMVV_LOG_LEVEL_INFO
+#define log_info(...)                                                          \
+  do {                                                                         \
+    if (0)                                                                     \
+      log_info(__VA_ARGS__);                                                   \
+  } while (0)
+#endif
+
+#if SHMEMVV_LOG_LEVEL < SHMEMVV_LOG_LEVEL_WARN
+#define log_warn(...)                                                          \
+  do {                                                                         \
+    if (0)                                                                     \
+      log_warn(__VA_ARGS__);                                                   \
+  } while (0)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -22,6 +22,23 @@
 
 #define HLINE "--------------------------------------------"
 
+/* Longest result line, and most failing PEs named in it */
+#define MAX_RESULT_LABEL_LEN 512
+#define MAX_LISTED_FAILED_PES 16
+
+/**
+  @brief Declares NAME as a symmetric array of COUNT TYPEs, zeroed when
+         first used. Data in a test module dlopen'd by shmemvv_runner is not
+         symmetric, so there the array comes from the runner's symmetric
+         module heap instead of static storage.
+ */
+#ifdef SHMEMVV_TEST_MODULE
+#define SHMEMVV_SYMMETRIC_ARRAY(TYPE, NAME, COUNT)                             \
+  TYPE *NAME = (TYPE *)shmemvv_module_alloc(sizeof(TYPE) * (COUNT))
+#else
+#define SHMEMVV_SYMMETRIC_ARRAY(TYPE, NAME, COUNT) static TYPE NAME[COUNT]
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -41,6 +58,15 @@ void display_not_enough_pes(const char *test_type);
  */
 void display_test_result(const char *routine_name, bool passed, bool required);
 
+/**
+  @brief Combines a test result across all PEs and displays it on PE 0,
+         naming the PEs the test failed on. Must be called by every PE.
+  @param routine_name OpenSHMEM routine that was tested
+  @param passed True if the test passed on this PE
+  @param required True if the test is required, false otherwise
+  @return True if the test passed on every PE
+ */
+bool check_test_result(const char *routine_name, bool passed, bool required);
 
 /**
   @brief pulls results from all PEs, displays results
@@ -50,6 +76,14 @@ void display_test_result(const char *routine_name, bool passed, bool required);
  */
 void reduce_test_result(const char *routine_name, bool *result, bool required);
 
+/**
+  @brief Carves a zeroed array out of shmemvv_runner's symmetric module heap
+         for SHMEMVV_SYMMETRIC_ARRAY(); only defined in shmemvv_runner
+  @param size Size of the array in bytes
+  @return Symmetric address of the array
+ */
+void *shmemvv_module_alloc(size_t size);
+
 #ifdef __cplusplus
 }
 #endif
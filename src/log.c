@@ -1,5 +1,10 @@
 #include "log.h"
 
+/* log.c always provides the real functions, even when log.h compiles the
+ * calls out of the tests. */
+#undef log_info
+#undef log_warn
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -13,23 +18,237 @@ extern "C" {
  */
 FILE *LOGGER = NULL;
 
+/* Longest formatted record, leaving room for JSON escapes */
+#define LOG_RECORD_LEN (2 * MAX_LOG_LEN + 192)
+
+/* A log record as logged, formatted only when it is written out */
+typedef struct {
+  struct timespec time;
+  const char *level;
+  char prefix[32];
+  char message[MAX_LOG_LEN];
+  char routine[MAX_LOG_LEN];
+} log_record_t;
+
+/* Ring buffer of the most recent records, NULL when unbuffered */
+static log_record_t *log_buffer = NULL;
+static size_t log_buffer_size = 0;
+static size_t log_buffer_count = 0;
+
+/* Flush LOGGER after every unbuffered record, set by log_init() */
+static bool log_flush_records = false;
+
+/* Wall clock time at the monotonic clock's epoch, set by log_init() */
+static struct timespec log_clock_offset = {0, 0};
+
+/* Structured output state, set by log_init() and log_routine() */
+static bool log_jsonl = false;
+static int log_pe = -1;
+static char log_test_name[MAX_LOG_LEN] = "";
+static char log_current_routine[MAX_LOG_LEN] = "";
+
+/* Timed log_routine() sections since the last log_take_timings() */
+static log_timing_t *log_timings = NULL;
+static int log_timings_count = 0;
+static int log_timings_size = 0;
+static bool log_routine_open = false;
+static struct timespec log_routine_start;
+
+/**
+  @brief Copy `src` into `dst` as the body of a JSON string, truncating to
+         fit in `size` bytes including the terminator.
+ */
+static void json_escape(char *dst, size_t size, const char *src) {
+  size_t n = 0;
+  for (; *src != '\0'; src++) {
+    char esc[8];
+    unsigned char c = (unsigned char)*src;
+    if (c == '"' || c == '\\') {
+      snprintf(esc, sizeof(esc), "\\%c", c);
+    } else if (c == '\n') {
+      snprintf(esc, sizeof(esc), "\\n");
+    } else if (c == '\t') {
+      snprintf(esc, sizeof(esc), "\\t");
+    } else if (c < 0x20) {
+      snprintf(esc, sizeof(esc), "\\u%04x", c);
+    } else {
+      esc[0] = (char)c;
+      esc[1] = '\0';
+    }
+    size_t len = strlen(esc);
+    if (n + len >= size) {
+      break;
+    }
+    memcpy(dst + n, esc, len);
+    n += len;
+  }
+  dst[n] = '\0';
+}
+
+/**
+  @brief Write a formatted record stamped with a CLOCK_MONOTONIC time to
+         LOGGER, rendered as wall clock time.
+ */
+static void log_write(const struct timespec *now, const char *line) {
+  time_t seconds = log_clock_offset.tv_sec + now->tv_sec;
+  long nanoseconds = log_clock_offset.tv_nsec + now->tv_nsec;
+  struct tm timeinfo;
+
+  if (nanoseconds >= 1000000000L) {
+    seconds++;
+    nanoseconds -= 1000000000L;
+  }
+
+  if (log_jsonl) {
+    fprintf(LOGGER, "{\"time\":%lld.%09ld,%s}\n", (long long)seconds,
+            nanoseconds, line);
+    return;
+  }
+
+  localtime_r(&seconds, &timeinfo);
+  fprintf(LOGGER, "[%02d:%02d:%02d.%03ld] %s\n", timeinfo.tm_hour,
+          timeinfo.tm_min, timeinfo.tm_sec, nanoseconds / 1000000L, line);
+}
+
+/**
+  @brief Format a record as one line, without its time stamp.
+ */
+static void log_format(const log_record_t *record, char *line) {
+  if (log_jsonl) {
+    char message[MAX_LOG_LEN + 32];
+    char escaped_message[LOG_RECORD_LEN / 2];
+    char escaped_routine[LOG_RECORD_LEN / 4];
+    snprintf(message, sizeof(message), "%s%s", record->prefix,
+             record->message);
+    json_escape(escaped_message, sizeof(escaped_message), message);
+    json_escape(escaped_routine, sizeof(escaped_routine), record->routine);
+    snprintf(line, LOG_RECORD_LEN,
+             "\"pe\":%d,\"level\":\"%s\",\"routine\":\"%s\",\"msg\":\"%s\"",
+             log_pe, record->level, escaped_routine, escaped_message);
+  } else {
+    snprintf(line, LOG_RECORD_LEN, "%s%s", record->prefix, record->message);
+  }
+}
+
+/**
+  @brief Start a record of the given level: the next buffer slot in
+         buffered mode, `unbuffered` otherwise. The caller fills in its
+         prefix and message and passes it to log_end_record().
+ */
+static log_record_t *log_begin_record(log_record_t *unbuffered,
+                                      const char *level) {
+  log_record_t *record = unbuffered;
+  if (log_buffer != NULL) {
+    record = &log_buffer[log_buffer_count++ % log_buffer_size];
+  }
+  clock_gettime(CLOCK_MONOTONIC, &record->time);
+  record->level = level;
+  if (log_jsonl) {
+    snprintf(record->routine, sizeof(record->routine), "%s",
+             log_current_routine);
+  }
+  return record;
+}
+
+/**
+  @brief Write a record started by log_begin_record() unless it is kept in
+         the buffer until the next flush.
+ */
+static void log_end_record(const log_record_t *record) {
+  if (log_buffer != NULL) {
+    return;
+  }
+
+  char line[LOG_RECORD_LEN];
+  log_format(record, line);
+  log_write(&record->time, line);
+  if (log_flush_records) {
+    fflush(LOGGER);
+  }
+}
+
+/**
+  @brief Record `prefix` and `string` as one record of the given level.
+ */
+static void log_record(const char *level, const char *prefix,
+                       const char *string) {
+  log_record_t unbuffered;
+  log_record_t *record = log_begin_record(&unbuffered, level);
+  snprintf(record->prefix, sizeof(record->prefix), "%s", prefix);
+  snprintf(record->message, sizeof(record->message), "%s", string);
+  log_end_record(record);
+}
+
+/**
+  @brief Format and record a message logged through log_info(), log_warn()
+         or log_fail().
+ */
+static void log_message(const char *level, const char *fstring, va_list va) {
+  log_record_t unbuffered;
+  log_record_t *record = log_begin_record(&unbuffered, level);
+  bool truncated = vsnprintf(record->message, sizeof(record->message),
+                             fstring, va) > MAX_LOG_LEN;
+
+  if (log_jsonl) {
+    snprintf(record->prefix, sizeof(record->prefix), "%s",
+             truncated ? "(trunc) " : "");
+  } else {
+    snprintf(record->prefix, sizeof(record->prefix), "[%s] %s", level,
+             truncated ? "(trunc) " : "");
+  }
+  log_end_record(record);
+}
+
 /**
   @brief Output a line of information to the global LOGGER.
 
   Prefixed with current time and prefix, in that order. Affixed with \n.
+  In buffered mode the line is only written out by the next flush. In
+  JSONL mode the line becomes the message of an INFO record.
  */
 void log_line(const char *string, const char *prefix) {
-  time_t time_since_epoch = time(NULL);
-  struct tm *timeinfo;
-  struct timeval tv;
+  log_record("INFO", prefix, string);
+}
 
-  time(&time_since_epoch);
-  timeinfo = localtime(&time_since_epoch);
-  gettimeofday(&tv, NULL);
+/**
+   Writes any buffered log records to the log file and flushes it.
 
-  fprintf(LOGGER, "[%02d:%02d:%02d.%03ld] %s%s\n", timeinfo->tm_hour,
-          timeinfo->tm_min, timeinfo->tm_sec, (long int)tv.tv_usec / 1000,
-          prefix, string);
+   If more records were logged than the buffer holds since the last flush,
+   only the most recent ones are written, after a note of how many were lost.
+ */
+void log_flush(void) {
+  if (LOGGER == NULL) {
+    return;
+  }
+  if (log_buffer == NULL || log_buffer_count == 0) {
+    fflush(LOGGER);
+    return;
+  }
+
+  size_t first = 0;
+  if (log_buffer_count > log_buffer_size) {
+    char note[LOG_RECORD_LEN];
+    first = log_buffer_count - log_buffer_size;
+    if (log_jsonl) {
+      snprintf(note, sizeof(note),
+               "\"pe\":%d,\"level\":\"WARN\",\"routine\":\"\","
+               "\"msg\":\"%zu earlier records dropped\"",
+               log_pe, first);
+    } else {
+      snprintf(note, sizeof(note), "(%zu earlier records dropped)", first);
+    }
+    log_write(&log_buffer[first % log_buffer_size].time, note);
+  }
+
+  for (size_t i = first; i < log_buffer_count; i++) {
+    log_record_t *record = &log_buffer[i % log_buffer_size];
+    char line[LOG_RECORD_LEN];
+    log_format(record, line);
+    log_write(&record->time, line);
+  }
+
+  log_buffer_count = 0;
+  fflush(LOGGER);
 }
 
 /**
@@ -41,13 +260,8 @@ void log_line(const char *string, const char *prefix) {
  */
 void log_info(const char *fstring, ...) {
   va_list va;
-  char buf[MAX_LOG_LEN];
   va_start(va, fstring);
-  if (vsnprintf(buf, MAX_LOG_LEN, fstring, va) > MAX_LOG_LEN) {
-    log_line(buf, "[INFO] (trunc) ");
-  } else {
-    log_line(buf, "[INFO] ");
-  }
+  log_message("INFO", fstring, va);
   va_end(va);
 }
 
@@ -60,20 +274,17 @@ void log_info(const char *fstring, ...) {
  */
 void log_warn(const char *fstring, ...) {
   va_list va;
-  char buf[MAX_LOG_LEN];
   va_start(va, fstring);
-  if (vsnprintf(buf, MAX_LOG_LEN, fstring, va) > MAX_LOG_LEN) {
-    log_line(buf, "[WARN] (trunc) ");
-  } else {
-    log_line(buf, "[WARN] ");
-  }
+  log_message("WARN", fstring, va);
   va_end(va);
 }
 
 /**
    Logs a fatal message to the logger.
 
-   Calling this function does not cause the program to exit.
+   Calling this function does not cause the program to exit. In buffered
+   mode it flushes the buffer so the records leading up to the failure are
+   written out.
 
    @param fstring Format string specifying the message to be logged.
    @param ... Variable arguments to be formatted into the message using
@@ -81,24 +292,113 @@ void log_warn(const char *fstring, ...) {
  */
 void log_fail(const char *fstring, ...) {
   va_list va;
-  char buf[MAX_LOG_LEN];
   va_start(va, fstring);
-  if (vsnprintf(buf, MAX_LOG_LEN, fstring, va) > MAX_LOG_LEN) {
-    log_line(buf, "[FAIL] (trunc) ");
-  } else {
-    log_line(buf, "[FAIL] ");
-  }
+  log_message("FAIL", fstring, va);
   va_end(va);
+  log_flush();
+}
+
+/**
+  @brief Record the time spent in the current log_routine() section, if any.
+ */
+static void log_end_routine(void) {
+  if (!log_routine_open) {
+    return;
+  }
+  log_routine_open = false;
+
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+
+  if (log_timings_count == log_timings_size) {
+    int size = log_timings_size ? 2 * log_timings_size : 64;
+    log_timing_t *timings = realloc(log_timings, size * sizeof(log_timing_t));
+    if (timings == NULL) {
+      return;
+    }
+    log_timings = timings;
+    log_timings_size = size;
+  }
+
+  log_timing_t *timing = &log_timings[log_timings_count++];
+  snprintf(timing->routine, sizeof(timing->routine), "%s",
+           log_current_routine);
+  timing->seconds = (now.tv_sec - log_routine_start.tv_sec) +
+                    (now.tv_nsec - log_routine_start.tv_nsec) * 1e-9;
+}
+
+int log_take_timings(log_timing_t **timings) {
+  log_end_routine();
+
+  int count = log_timings_count;
+  log_timings_count = 0;
+  *timings = log_timings;
+  return count;
+}
+
+void log_result_record(const char *result_name, bool passed,
+                       const log_timing_t *timing, int npes,
+                       double min_seconds, double max_seconds) {
+  const char *path = getenv("SHMEMVV_RESULTS_FILE");
+  if (path == NULL || *path == '\0') {
+    return;
+  }
+
+  char test[MAX_LOG_LEN], result[MAX_LOG_LEN], routine[MAX_LOG_LEN];
+  json_escape(test, sizeof(test), log_test_name);
+  json_escape(result, sizeof(result), result_name);
+  json_escape(routine, sizeof(routine), timing->routine);
+
+  /* One write per record, so concurrently running tests can share a file */
+  char record[4 * MAX_LOG_LEN];
+  int len = snprintf(record, sizeof(record),
+                     "{\"test\":\"%s\",\"result\":\"%s\",\"passed\":%s,"
+                     "\"routine\":\"%s\",\"npes\":%d,\"min\":%.9f,"
+                     "\"max\":%.9f,\"mean\":%.9f}\n",
+                     test, result, passed ? "true" : "false", routine, npes,
+                     min_seconds, max_seconds, timing->seconds);
+
+  if (len < 0) {
+    fprintf(stderr, "Failed to format the result record of %s\n",
+            log_test_name);
+    return;
+  }
+  /* A truncated record loses its newline, but still ends the line */
+  size_t size = (size_t)len < sizeof(record) ? (size_t)len : sizeof(record) - 1;
+
+  FILE *file = fopen(path, "a");
+  if (file == NULL) {
+    fprintf(stderr, "Failed to open results file %s (error %d: %s)\n", path,
+            errno, strerror(errno));
+    return;
+  }
+  setvbuf(file, NULL, _IOFBF, sizeof(record));
+  fwrite(record, 1, size, file);
+  fclose(file);
 }
 
 void log_routine(const char *routine) {
-  log_line("---------------------------------------------------", "");
-  log_line(&routine[0], "------ BEGIN TEST ROUTINE: ");
-  log_line("---------------------------------------------------", "");
+  log_end_routine();
+  snprintf(log_current_routine, sizeof(log_current_routine), "%s", routine);
+
+  if (log_jsonl) {
+    log_record("ROUTINE", "", routine);
+  } else {
+    log_line("---------------------------------------------------", "");
+    log_line(&routine[0], "------ BEGIN TEST ROUTINE: ");
+    log_line("---------------------------------------------------", "");
+  }
+
+  /* Start timing once the banner is written */
+  log_routine_open = true;
+  clock_gettime(CLOCK_MONOTONIC, &log_routine_start);
 }
 
 void log_init(const char *test_name) {
   /* Close existing logger if it exists and is not stdout/stderr */
+  if (LOGGER) {
+    log_flush();
+  }
   if (LOGGER && LOGGER != stdout && LOGGER != stderr) {
     fclose(LOGGER);
     LOGGER = NULL;
@@ -109,12 +409,24 @@ void log_init(const char *test_name) {
     LOGGER = NULL;
   }
 
+  /* Write structured JSONL records if requested */
+  const char *format = getenv("SHMEMVV_LOG_FORMAT");
+  log_jsonl = format && strcmp(format, "jsonl") == 0;
+  log_pe = shmem_my_pe();
+  log_current_routine[0] = '\0';
+  log_routine_open = false;
+  log_timings_count = 0;
+  char *test_path = strdup(test_name);
+  snprintf(log_test_name, sizeof(log_test_name), "%s",
+           test_path != NULL ? basename(test_path) : test_name);
+  free(test_path);
+
   const char *path_prefix = getenv("SHMEMVV_LOG_DIR");
   if (!path_prefix)
     path_prefix = "/tmp/";
-  char path_buf[256];
-  snprintf(path_buf, 256, "%s%s.pe%02d.log", path_prefix,
-           basename(strdup(test_name)), shmem_my_pe());
+  char path_buf[256 + MAX_LOG_LEN];
+  snprintf(path_buf, sizeof(path_buf), "%s%s.pe%02d.%s", path_prefix,
+           log_test_name, log_pe, log_jsonl ? "jsonl" : "log");
   FILE *maybe_file = fopen(path_buf, "w+");
   if (maybe_file == NULL) {
     fprintf(stderr,
@@ -123,12 +435,62 @@ void log_init(const char *test_name) {
     maybe_file = stdout;
   }
   LOGGER = maybe_file ? maybe_file : stderr;
-  fprintf(LOGGER, "---------- BEGIN TEST: %s\n", test_name);
+  if (!log_jsonl) {
+    fprintf(LOGGER, "---------- BEGIN TEST: %s\n", test_name);
+  }
+
+  /* Anchor monotonic record times to the wall clock once per test */
+  struct timespec mono, real;
+  clock_gettime(CLOCK_MONOTONIC, &mono);
+  clock_gettime(CLOCK_REALTIME, &real);
+  log_clock_offset.tv_sec = real.tv_sec - mono.tv_sec;
+  log_clock_offset.tv_nsec = real.tv_nsec - mono.tv_nsec;
+  if (log_clock_offset.tv_nsec < 0) {
+    log_clock_offset.tv_sec--;
+    log_clock_offset.tv_nsec += 1000000000L;
+  }
+
+  /* Flush each record if requested, and whatever is left on exit() */
+  static bool flush_at_exit = false;
+  const char *flush = getenv("SHMEMVV_LOG_FLUSH");
+  log_flush_records = flush && strcmp(flush, "1") == 0;
+  if (!flush_at_exit) {
+    flush_at_exit = atexit(log_flush) == 0;
+  }
+
+  /* Buffer records in memory if requested */
+  free(log_buffer);
+  log_buffer = NULL;
+  log_buffer_count = 0;
+  const char *buffer_size = getenv("SHMEMVV_LOG_BUFFER");
+  log_buffer_size = buffer_size ? strtoul(buffer_size, NULL, 10) : 0;
+  if (log_buffer_size > 0) {
+    log_buffer = malloc(log_buffer_size * sizeof(log_record_t));
+    if (log_buffer == NULL) {
+      fprintf(LOGGER, "Failed to allocate a %zu record log buffer. "
+                      "Logging unbuffered.\n",
+              log_buffer_size);
+    }
+  }
+
+  if (log_jsonl) {
+    log_record("BEGIN", "", test_name);
+  }
 }
 
 void log_close(int failed) {
-  fprintf(LOGGER, "---------- END TEST: %s\n",
-          failed == 0 ? "PASSED" : "FAILED");
+  if (log_jsonl) {
+    log_record("END", "", failed == 0 ? "PASSED" : "FAILED");
+  }
+
+  log_flush();
+  free(log_buffer);
+  log_buffer = NULL;
+
+  if (!log_jsonl) {
+    fprintf(LOGGER, "---------- END TEST: %s\n",
+            failed == 0 ? "PASSED" : "FAILED");
+  }
 
   /* Only close if it's a real file, not stdout/stderr */
   if (LOGGER && LOGGER != stdout && LOGGER != stderr) {
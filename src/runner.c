@@ -0,0 +1,161 @@
+/**
+ * @file runner.c
+ * @brief Resident test module runner.
+ *
+ * Usage: shmemvv_runner <module.so> [<module.so> ...]
+ *
+ * Initializes OpenSHMEM once, then dlopens each test module in turn and
+ * calls its run() entry point with a barrier on either side. Every PE must
+ * be given the same list of modules in the same order.
+ *
+ * Data in a dlopen'd shared object is not symmetric, so tests declare
+ * their symmetric arrays with SHMEMVV_SYMMETRIC_ARRAY(), which in a module
+ * carves them out of the runner's symmetric module heap. The heap is
+ * zeroed and rewound before each module; since every PE runs the same
+ * tests in the same order, every array lands at the same offset on every
+ * PE.
+ */
+
+#include <shmem.h>
+#include <dlfcn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "driver.h"
+#include "shmemvv.h"
+
+/* Size of the symmetric heap shared by the tests of one module */
+#define RUNNER_MODULE_HEAP_SIZE (1 << 20)
+
+/* Alignment of each array carved out of it, enough for any type */
+#define RUNNER_MODULE_HEAP_ALIGN 16
+
+static char *module_heap;
+static size_t module_heap_used;
+
+/**
+ * @brief Carve a zeroed array out of the symmetric module heap.
+ *
+ * Called by SHMEMVV_SYMMETRIC_ARRAY() in test modules. Running out of
+ * module heap is a bug in the runner's sizing, so it aborts the job.
+ *
+ * @param size Size of the array in bytes.
+ * @return Symmetric address of the array.
+ */
+void *shmemvv_module_alloc(size_t size) {
+  size_t offset = (module_heap_used + RUNNER_MODULE_HEAP_ALIGN - 1) &
+                  ~(size_t)(RUNNER_MODULE_HEAP_ALIGN - 1);
+
+  if (size > RUNNER_MODULE_HEAP_SIZE - offset) {
+    fprintf(stderr,
+            "Runner: PE %d: module heap of %d bytes exhausted by a %zu byte "
+            "array\n",
+            shmem_my_pe(), RUNNER_MODULE_HEAP_SIZE, size);
+    shmem_global_exit(EXIT_FAILURE);
+  }
+
+  module_heap_used = offset + size;
+  return module_heap + offset;
+}
+
+/**
+ * @brief Load a test module and check that it can run on this PE.
+ *
+ * @param path Path of the module to load.
+ * @param handle Set to the module handle, or NULL if it failed to load.
+ * @return The module's run() entry point if the module loaded and exports
+ *         run(); NULL otherwise.
+ */
+static shmemvv_test_main_t load_module(const char *path, void **handle) {
+  *handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+  if (*handle == NULL) {
+    fprintf(stderr, "Runner: PE %d could not load %s: %s\n", shmem_my_pe(),
+            path, dlerror());
+    return NULL;
+  }
+
+  shmemvv_test_main_t run = (shmemvv_test_main_t)dlsym(*handle, "run");
+  if (run == NULL) {
+    fprintf(stderr, "Runner: PE %d: %s is not a shmemvv test module\n",
+            shmem_my_pe(), path);
+  }
+
+  return run;
+}
+
+int main(int argc, char *argv[]) {
+  static int module_ok, all_ok, module_rc, max_rc;
+
+  shmem_init();
+
+  int mype = shmem_my_pe();
+  int nmodules = argc - 1;
+  int nfailed = 0;
+  int nskipped = 0;
+
+  if (nmodules < 1) {
+    if (mype == 0) {
+      fprintf(stderr, "Usage: %s <module.so> [<module.so> ...]\n", argv[0]);
+    }
+    shmem_finalize();
+    return EXIT_FAILURE;
+  }
+
+  module_heap = shmem_malloc(RUNNER_MODULE_HEAP_SIZE);
+  if (module_heap == NULL) {
+    if (mype == 0) {
+      fprintf(stderr, "Runner: could not allocate a %d byte module heap\n",
+              RUNNER_MODULE_HEAP_SIZE);
+    }
+    shmem_global_exit(EXIT_FAILURE);
+  }
+
+  for (int i = 1; i < argc; i++) {
+    void *handle;
+    shmemvv_test_main_t run = load_module(argv[i], &handle);
+
+    /* Every PE must be able to run the module before any PE starts it */
+    module_ok = run != NULL;
+    memset(module_heap, 0, RUNNER_MODULE_HEAP_SIZE);
+    module_heap_used = 0;
+    shmem_barrier_all();
+    shmem_int_min_reduce(SHMEM_TEAM_WORLD, &all_ok, &module_ok, 1);
+
+    if (!all_ok) {
+      nskipped++;
+      if (mype == 0) {
+        fprintf(stderr,
+                "Runner: skipping %s, it did not load on every PE\n",
+                argv[i]);
+      }
+    } else {
+      char *module_argv[] = {argv[i], NULL};
+      module_rc = run(1, module_argv) == EXIT_SUCCESS ? 0 : 1;
+      shmem_barrier_all();
+
+      shmem_int_max_reduce(SHMEM_TEAM_WORLD, &max_rc, &module_rc, 1);
+      if (max_rc != 0) {
+        nfailed++;
+        if (mype == 0) {
+          fprintf(stderr,
+                  "Runner: %s exited with an error on at least one PE\n",
+                  argv[i]);
+        }
+      }
+    }
+
+    if (handle != NULL) {
+      dlclose(handle);
+    }
+  }
+
+  if (mype == 0) {
+    printf("Runner: %d of %d test modules exited successfully, %d skipped\n",
+           nmodules - nfailed - nskipped, nmodules, nskipped);
+  }
+
+  shmem_free(module_heap);
+  shmem_finalize();
+  return nfailed == 0 && nskipped == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
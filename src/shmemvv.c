@@ -4,6 +4,8 @@
  */
 
 #include "shmemvv.h"
+#include "driver.h"
+#include "log.h"
 
 /**
  * @brief Print error message saying that there needs to be at least
@@ -45,13 +47,146 @@ void display_test_result(const char *routine_name, bool passed, bool required) {
   }
 }
 
-void reduce_test_result(const char *routine_name, bool *result, bool required) {
+/**
+ * @brief Reduces the log_routine() timings since the last result across
+ *        all PEs and has PE 0 record their min/max/mean.
+ *
+ * The timings are only combined if every PE timed the same number of
+ * routines; otherwise they are dropped with a warning. Every PE must call
+ * this function.
+ *
+ * @param routine_name Name the test result is displayed under.
+ * @param passed True if the test passed on every PE.
+ */
+static void report_test_timings(const char *routine_name, bool passed) {
+  static int counts[2], max_counts[2];
+  log_timing_t *timings;
   int npes = shmem_n_pes();
-  bool passed = true;
+
+  /* max of {count, -count} gives the largest and smallest count at once */
+  int count = log_take_timings(&timings);
+  counts[0] = count;
+  counts[1] = -count;
+  shmem_int_max_reduce(SHMEM_TEAM_WORLD, max_counts, counts, 2);
+  if (max_counts[0] != -max_counts[1]) {
+    log_warn("Dropping the timings of %s: PEs timed %d to %d routines",
+             routine_name, -max_counts[1], max_counts[0]);
+    if (shmem_my_pe() == 0 && getenv("SHMEMVV_RESULTS_FILE") != NULL) {
+      fprintf(stderr,
+              YELLOW_COLOR "WARNING" RESET_COLOR
+                           ": Not recording the timings of %s, PEs timed "
+                           "%d to %d routines\n",
+              routine_name, -max_counts[1], max_counts[0]);
+    }
+    return;
+  }
+  if (count == 0) {
+    return;
+  }
+
+  /* Likewise max of {t, -t} gives the longest and shortest times */
+  double *seconds = shmem_malloc(6 * count * sizeof(double));
+  double *max_seconds = seconds + 2 * count;
+  double *sum_seconds = seconds + 4 * count;
+  for (int i = 0; i < count; i++) {
+    seconds[i] = timings[i].seconds;
+    seconds[count + i] = -timings[i].seconds;
+  }
+  shmem_double_max_reduce(SHMEM_TEAM_WORLD, max_seconds, seconds, 2 * count);
+  shmem_double_sum_reduce(SHMEM_TEAM_WORLD, sum_seconds, seconds, count);
+
   if (shmem_my_pe() == 0) {
-    for (int i = 0; i < npes; i ++){
-      passed &= shmem_g((char *)result, i);
+    for (int i = 0; i < count; i++) {
+      timings[i].seconds = sum_seconds[i] / npes;
+      log_result_record(routine_name, passed, &timings[i], npes,
+                        -max_seconds[count + i], max_seconds[i]);
+    }
+  }
+
+  shmem_free(seconds);
+}
+
+/**
+ * @brief Combines a test result across all PEs and displays it on PE 0.
+ *
+ * The results are combined with an AND reduction over SHMEM_TEAM_WORLD.
+ * Only if the test failed somewhere are the per-PE results collected, so
+ * that PE 0 can name the PEs the test failed on. The timings of the
+ * log_routine() sections since the previous result are reduced as well.
+ * Every PE must call this function.
+ *
+ * @param routine_name Name of the OpenSHMEM routine that was tested.
+ * @param passed True if the test passed on this PE.
+ * @param required True if the test is required, false otherwise.
+ * @return True if the test passed on every PE.
+ */
+bool check_test_result(const char *routine_name, bool passed, bool required) {
+  static unsigned char pe_passed, all_passed;
+  int mype = shmem_my_pe();
+  int npes = shmem_n_pes();
+
+  pe_passed = passed;
+  shmem_uchar_and_reduce(SHMEM_TEAM_WORLD, &all_passed, &pe_passed, 1);
+  report_test_timings(routine_name, all_passed);
+
+  if (all_passed) {
+    if (mype == 0) {
+      display_test_result(routine_name, true, required);
+    }
+    return true;
+  }
+
+  unsigned char *results = shmem_malloc(npes);
+  shmem_fcollectmem(SHMEM_TEAM_WORLD, results, &pe_passed, 1);
+
+  if (mype == 0) {
+    char label[MAX_RESULT_LABEL_LEN];
+    int len = snprintf(label, sizeof(label), "%s (failed on PE", routine_name);
+    int nfailed = 0;
+    for (int pe = 0; pe < npes; pe++) {
+      if (results[pe]) {
+        continue;
+      }
+      if (nfailed < MAX_LISTED_FAILED_PES && len < (int)sizeof(label)) {
+        len += snprintf(label + len, sizeof(label) - len, "%s %d",
+                        nfailed == 0 ? "" : ",", pe);
+      }
+      nfailed++;
+    }
+    if (nfailed > MAX_LISTED_FAILED_PES && len < (int)sizeof(label)) {
+      len += snprintf(label + len, sizeof(label) - len, " and %d more",
+                      nfailed - MAX_LISTED_FAILED_PES);
+    }
+    if (len < (int)sizeof(label)) {
+      snprintf(label + len, sizeof(label) - len, ")");
     }
-    display_test_result(routine_name, passed, required);
+    display_test_result(label, false, required);
   }
+
+  shmem_free(results);
+  return false;
+}
+
+/**
+ * @brief Combines the result of a test held in a symmetric variable across
+ *        all PEs and displays it on PE 0. Every PE must call this function.
+ *
+ * @param routine_name Name of the OpenSHMEM routine that was tested.
+ * @param result Symmetric address of this PE's result.
+ * @param required True if the test is required, false otherwise.
+ */
+void reduce_test_result(const char *routine_name, bool *result, bool required) {
+  check_test_result(routine_name, *result, required);
 }
+
+/**
+ * @brief No-op stand-in for shmem_init() in tests run by a category driver
+ *        or shmemvv_runner, which initialize OpenSHMEM once themselves.
+ */
+void shmemvv_driver_init(void) {}
+
+/**
+ * @brief No-op stand-in for shmem_finalize() in tests run by a category
+ *        driver or shmemvv_runner, which finalize once all tests have run.
+ */
+void shmemvv_driver_finalize(void) {}
@@ -110,9 +110,7 @@ int main(int argc, char *argv[]) {
   result &= TEST_C_SHMEM_ATOMIC_ADD(size_t, size);
   result &= TEST_C_SHMEM_ATOMIC_ADD(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_atomic_add", result, false);
-  }
+  check_test_result("C shmem_atomic_add", result, false);
 
   /* Test context-specific atomic add operations */
   bool result_ctx = true;
@@ -129,9 +127,7 @@ int main(int argc, char *argv[]) {
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_ADD(size_t, size);
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_ADD(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_atomic_add", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_atomic_add", result_ctx, false);
 
   if (!result || !result_ctx) {
     rc = EXIT_FAILURE;
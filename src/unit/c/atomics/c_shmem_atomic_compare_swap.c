@@ -114,9 +114,7 @@ int main(int argc, char *argv[]) {
   result &= TEST_C_SHMEM_ATOMIC_COMPARE_SWAP(size_t, size);
   result &= TEST_C_SHMEM_ATOMIC_COMPARE_SWAP(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_atomic_compare_swap", result, false);
-  }
+  check_test_result("C shmem_atomic_compare_swap", result, false);
 
   /* Test context-specific atomic compare swap operations */
   bool result_ctx = true;
@@ -134,9 +132,7 @@ int main(int argc, char *argv[]) {
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_COMPARE_SWAP(size_t, size);
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_COMPARE_SWAP(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_atomic_compare_swap", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_atomic_compare_swap", result_ctx, false);
 
   if (!result || !result_ctx) {
     rc = EXIT_FAILURE;
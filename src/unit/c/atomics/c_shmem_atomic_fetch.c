@@ -106,9 +106,7 @@ int main(int argc, char *argv[]) {
   result &= TEST_C_SHMEM_ATOMIC_FETCH(size_t, size);
   result &= TEST_C_SHMEM_ATOMIC_FETCH(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_atomic_fetch", result, false);
-  }
+  check_test_result("C shmem_atomic_fetch", result, false);
 
   /* Test context-specific atomic fetch operations */
   bool result_ctx = true;
@@ -125,9 +123,7 @@ int main(int argc, char *argv[]) {
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_FETCH(size_t, size);
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_FETCH(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_atomic_fetch", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_atomic_fetch", result_ctx, false);
 
   if (!result || !result_ctx) {
     rc = EXIT_FAILURE;
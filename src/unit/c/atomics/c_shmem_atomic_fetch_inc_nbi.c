@@ -110,9 +110,7 @@ int main(int argc, char *argv[]) {
   result &= TEST_C_SHMEM_ATOMIC_FETCH_INC_NBI(size_t, size);
   result &= TEST_C_SHMEM_ATOMIC_FETCH_INC_NBI(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_atomic_fetch_inc_nbi", result, false);
-  }
+  check_test_result("C shmem_atomic_fetch_inc_nbi", result, false);
 
   /* Test context-specific atomic fetch-inc nbi operations */
   bool result_ctx = true;
@@ -130,9 +128,7 @@ int main(int argc, char *argv[]) {
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_FETCH_INC_NBI(size_t, size);
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_FETCH_INC_NBI(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_atomic_fetch_inc_nbi", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_atomic_fetch_inc_nbi", result_ctx, false);
 
   if (!result || !result_ctx) {
     rc = EXIT_FAILURE;
@@ -111,9 +111,7 @@ int main(int argc, char *argv[]) {
   result &= TEST_C_SHMEM_ATOMIC_FETCH_XOR(uint32_t, uint32);
   result &= TEST_C_SHMEM_ATOMIC_FETCH_XOR(uint64_t, uint64);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_atomic_fetch_xor", result, false);
-  }
+  check_test_result("C shmem_atomic_fetch_xor", result, false);
 
   /* Test context-specific atomic fetch-xor operations */
   bool result_ctx = true;
@@ -126,9 +124,7 @@ int main(int argc, char *argv[]) {
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_FETCH_XOR(uint32_t, uint32);
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_FETCH_XOR(uint64_t, uint64);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_atomic_fetch_xor", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_atomic_fetch_xor", result_ctx, false);
 
   if (!result || !result_ctx) {
     rc = EXIT_FAILURE;
@@ -105,9 +105,7 @@ int main(int argc, char *argv[]) {
   result &= TEST_C_SHMEM_ATOMIC_INC(size_t, size);
   result &= TEST_C_SHMEM_ATOMIC_INC(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_atomic_inc", result, false);
-  }
+  check_test_result("C shmem_atomic_inc", result, false);
 
   /* Test context-specific atomic inc operations */
   bool result_ctx = true;
@@ -124,9 +122,7 @@ int main(int argc, char *argv[]) {
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_INC(size_t, size);
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_INC(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_atomic_inc", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_atomic_inc", result_ctx, false);
 
   if (!result || !result_ctx) {
     rc = EXIT_FAILURE;
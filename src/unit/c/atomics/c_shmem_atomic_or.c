@@ -104,9 +104,7 @@ int main(int argc, char *argv[]) {
   result &= TEST_C_SHMEM_ATOMIC_OR(uint32_t, uint32);
   result &= TEST_C_SHMEM_ATOMIC_OR(uint64_t, uint64);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_atomic_or", result, false);
-  }
+  check_test_result("C shmem_atomic_or", result, false);
 
   /* Test context-specific atomic or operations */
   bool result_ctx = true;
@@ -118,9 +116,7 @@ int main(int argc, char *argv[]) {
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_OR(uint32_t, uint32);
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_OR(uint64_t, uint64);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_atomic_or", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_atomic_or", result_ctx, false);
 
   if (!result || !result_ctx) {
     rc = EXIT_FAILURE;
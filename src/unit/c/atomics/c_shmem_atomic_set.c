@@ -105,9 +105,7 @@ int main(int argc, char *argv[]) {
   result &= TEST_C_SHMEM_ATOMIC_SET(size_t, size);
   result &= TEST_C_SHMEM_ATOMIC_SET(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_atomic_set", result, false);
-  }
+  check_test_result("C shmem_atomic_set", result, false);
 
   /* Test context-specific atomic set operations */
   bool result_ctx = true;
@@ -124,9 +122,7 @@ int main(int argc, char *argv[]) {
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_SET(size_t, size);
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_SET(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_atomic_set", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_atomic_set", result_ctx, false);
 
   if (!result || !result_ctx) {
     rc = EXIT_FAILURE;
@@ -111,9 +111,7 @@ int main(int argc, char *argv[]) {
   result &= TEST_C_SHMEM_ATOMIC_SWAP(size_t, size);
   result &= TEST_C_SHMEM_ATOMIC_SWAP(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_atomic_swap", result, false);
-  }
+  check_test_result("C shmem_atomic_swap", result, false);
 
   /* Test context-specific atomic swap operations */
   bool result_ctx = true;
@@ -130,9 +128,7 @@ int main(int argc, char *argv[]) {
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_SWAP(size_t, size);
   result_ctx &= TEST_C_CTX_SHMEM_ATOMIC_SWAP(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_atomic_swap", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_atomic_swap", result_ctx, false);
 
   if (!result || !result_ctx) {
     rc = EXIT_FAILURE;
@@ -104,9 +104,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_alltoall", result, false);
-  }
+  check_test_result("C shmem_alltoall", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
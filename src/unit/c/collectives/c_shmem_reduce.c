@@ -423,9 +423,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_max_reduce", result_max, false);
-  }
+  check_test_result("C shmem_max_reduce", result_max, false);
 
   if (!result_max) {
     rc = EXIT_FAILURE;
@@ -460,9 +458,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_min_reduce", result_min, false);
-  }
+  check_test_result("C shmem_min_reduce", result_min, false);
 
   if (!result_min) {
     rc = EXIT_FAILURE;
@@ -499,9 +495,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_sum_reduce", result_sum, false);
-  }
+  check_test_result("C shmem_sum_reduce", result_sum, false);
 
   if (!result_sum) {
     rc = EXIT_FAILURE;
@@ -538,9 +532,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_prod_reduce", result_prod, false);
-  }
+  check_test_result("C shmem_prod_reduce", result_prod, false);
 
   if (!result_prod) {
     rc = EXIT_FAILURE;
@@ -565,9 +557,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_and_reduce", result_and, false);
-  }
+  check_test_result("C shmem_and_reduce", result_and, false);
 
   if (!result_and) {
     rc = EXIT_FAILURE;
@@ -592,9 +582,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_or_reduce", result_or, false);
-  }
+  check_test_result("C shmem_or_reduce", result_or, false);
 
   if (!result_or) {
     rc = EXIT_FAILURE;
@@ -619,9 +607,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_xor_reduce", result_xor, false);
-  }
+  check_test_result("C shmem_xor_reduce", result_xor, false);
 
   if (!result_xor) {
     rc = EXIT_FAILURE;
@@ -50,9 +50,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_sync_all", result, false);
-  }
+  check_test_result("C shmem_sync_all", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
@@ -33,7 +33,7 @@ bool test_shmem_ctx_create_destroy(void) {
   return true;
 }
 
-int main(void) {
+int main(int argc, char *argv[]) {
   shmem_init();
   log_init(__FILE__);
 
@@ -53,10 +53,8 @@ int main(void) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_create", result, false);
-    display_test_result("C shmem_ctx_destroy", result, false);
-  }
+  check_test_result("C shmem_ctx_create", result, false);
+  check_test_result("C shmem_ctx_destroy", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
@@ -56,9 +56,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_team_create_ctx", result, false);
-  }
+  check_test_result("C shmem_team_create_ctx", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
@@ -57,9 +57,7 @@ int main(int argc, char *argv[]) {
   bool result = test_shmem_addr_accessible();
   int rc = EXIT_SUCCESS;
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_addr_accessible", result, false);
-  }
+  check_test_result("C shmem_addr_accessible", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
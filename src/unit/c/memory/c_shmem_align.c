@@ -40,9 +40,7 @@ int main(int argc, char *argv[]) {
   bool result = test_shmem_align();
   int rc = EXIT_SUCCESS;
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_align", result, false);
-  }
+  check_test_result("C shmem_align", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
@@ -52,9 +52,7 @@ int main(int argc, char *argv[]) {
   bool result = test_shmem_calloc();
   int rc = EXIT_SUCCESS;
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_calloc", result, false);
-  }
+  check_test_result("C shmem_calloc", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
@@ -73,9 +73,7 @@ int main(int argc, char **argv) {
   bool result = test_shmem_fence();
   int rc = EXIT_SUCCESS;
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_fence", result, false);
-  }
+  check_test_result("C shmem_fence", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
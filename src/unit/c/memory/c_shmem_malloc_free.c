@@ -46,10 +46,8 @@ int main(int argc, char *argv[]) {
   bool result = test_shmem_malloc_free();
   int rc = EXIT_SUCCESS;
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_malloc", result, false);
-    display_test_result("C shmem_free", result, false);
-  }
+  check_test_result("C shmem_malloc", result, false);
+  check_test_result("C shmem_free", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
@@ -51,9 +51,7 @@ int main(int argc, char *argv[]) {
   bool result = test_shmem_malloc_with_hints();
   int rc = EXIT_SUCCESS;
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_malloc_with_hints", result, false);
-  }
+  check_test_result("C shmem_malloc_with_hints", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
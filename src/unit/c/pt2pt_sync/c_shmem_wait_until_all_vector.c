@@ -108,9 +108,7 @@ int main(int argc, char **argv) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_wait_until_all_vector", result, false);
-  }
+  check_test_result("C shmem_wait_until_all_vector", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
@@ -14,16 +14,17 @@
   ({                                                                           \
     log_routine("shmem_" #TYPENAME "_g()");                                    \
     bool success = true;                                                       \
-    static TYPE src, dest;                                                     \
-    log_info("Allocated static variables: src at %p, dest at %p",              \
-             (void *)&src, (void *)&dest);                                     \
+    static TYPE dest;                                                          \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 1);                                     \
+    log_info("Allocated variables: src at %p, dest at %p",                     \
+             (void *)src, (void *)&dest);                                      \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
                                                                                \
     if (mype == 0) {                                                           \
-      src = 10;                                                                \
-      log_info("PE 0: Initialized src = %d", (int)src);                        \
+      *src = 10;                                                               \
+      log_info("PE 0: Initialized src = %d", (int)*src);                       \
     }                                                                          \
                                                                                \
     shmem_barrier_all();                                                       \
@@ -31,7 +32,7 @@
                                                                                \
     if (mype == 1) {                                                           \
       log_info("PE 1: Fetching remote value from PE 0");                       \
-      dest = shmem_##TYPENAME##_g(&src, 0);                                    \
+      dest = shmem_##TYPENAME##_g(src, 0);                                     \
       log_info("PE 1: Fetched value dest = %d", (int)dest);                    \
     }                                                                          \
                                                                                \
@@ -58,9 +59,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_" #TYPENAME "_g()");                                \
     bool success = true;                                                       \
-    static TYPE src, dest;                                                     \
-    log_info("Allocated static variables: src at %p, dest at %p",              \
-             (void *)&src, (void *)&dest);                                     \
+    static TYPE dest;                                                          \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 1);                                     \
+    log_info("Allocated variables: src at %p, dest at %p",                     \
+             (void *)src, (void *)&dest);                                      \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -76,8 +78,8 @@
     log_info("Successfully created context");                                  \
                                                                                \
     if (mype == 0) {                                                           \
-      src = 20;                                                                \
-      log_info("PE 0: Initialized src = %d", (int)src);                        \
+      *src = 20;                                                               \
+      log_info("PE 0: Initialized src = %d", (int)*src);                       \
     }                                                                          \
                                                                                \
     shmem_barrier_all();                                                       \
@@ -85,7 +87,7 @@
                                                                                \
     if (mype == 1) {                                                           \
       log_info("PE 1: Fetching remote value from PE 0 using context");         \
-      dest = shmem_ctx_##TYPENAME##_g(ctx, &src, 0);                           \
+      dest = shmem_ctx_##TYPENAME##_g(ctx, src, 0);                            \
       log_info("PE 1: Fetched value dest = %d", (int)dest);                    \
     }                                                                          \
                                                                                \
@@ -155,9 +157,7 @@ int main(int argc, char *argv[]) {
   result &= TEST_C_SHMEM_G(size_t, size);
   result &= TEST_C_SHMEM_G(ptrdiff_t, ptrdiff);
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_g", result, false);
-  }
+  check_test_result("C shmem_g", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
@@ -193,9 +193,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_g", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_g", result_ctx, false);
 
   if (!result_ctx) {
     rc = EXIT_FAILURE;
@@ -14,9 +14,10 @@
   ({                                                                           \
     log_routine("shmem_" #TYPENAME "_get()");                                  \
     bool success = true;                                                       \
-    static TYPE src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -65,9 +66,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_" #TYPENAME "_get()");                              \
     bool success = true;                                                       \
-    static TYPE src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -131,9 +133,10 @@
   ({                                                                           \
     log_routine("shmem_get" #SIZE "()");                                       \
     bool success = true;                                                       \
-    static uint##SIZE##_t src[10], dest[10];                                   \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, src, 10);                          \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, dest, 10);                         \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -184,9 +187,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_get" #SIZE "()");                                   \
     bool success = true;                                                       \
-    static uint##SIZE##_t src[10], dest[10];                                   \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, src, 10);                          \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, dest, 10);                         \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -251,9 +255,10 @@
   ({                                                                           \
     log_routine("shmem_getmem()");                                             \
     bool success = true;                                                       \
-    static char src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(char, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(char, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -304,9 +309,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_getmem()");                                         \
     bool success = true;                                                       \
-    static char src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(char, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(char, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -411,9 +417,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_get", result, false);
-  }
+  check_test_result("C shmem_get", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
@@ -432,9 +436,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_get<size>", result_size, false);
-  }
+  check_test_result("C shmem_get<size>", result_size, false);
 
   if (!result_size) {
     rc = EXIT_FAILURE;
@@ -445,9 +447,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_getmem", result_mem, false);
-  }
+  check_test_result("C shmem_getmem", result_mem, false);
 
   if (!result_mem) {
     rc = EXIT_FAILURE;
@@ -483,9 +483,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_get", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_get", result_ctx, false);
 
   if (!result_ctx) {
     rc = EXIT_FAILURE;
@@ -504,9 +502,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_get<size>", result_ctx_size, false);
-  }
+  check_test_result("C shmem_ctx_get<size>", result_ctx_size, false);
 
   if (!result_ctx_size) {
     rc = EXIT_FAILURE;
@@ -517,9 +513,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_getmem", result_ctx_mem, false);
-  }
+  check_test_result("C shmem_ctx_getmem", result_ctx_mem, false);
 
   if (!result_ctx_mem) {
     rc = EXIT_FAILURE;
@@ -14,9 +14,10 @@
   ({                                                                           \
     log_routine("shmem_" #TYPENAME "_get_nbi()");                              \
     bool success = true;                                                       \
-    static TYPE src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -66,9 +67,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_" #TYPENAME "_get_nbi()");                          \
     bool success = true;                                                       \
-    static TYPE src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -133,9 +135,10 @@
   ({                                                                           \
     log_routine("shmem_get" #SIZE "_nbi()");                                   \
     bool success = true;                                                       \
-    static uint##SIZE##_t src[10], dest[10];                                   \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, src, 10);                          \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, dest, 10);                         \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -187,9 +190,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_get" #SIZE "_nbi()");                               \
     bool success = true;                                                       \
-    static uint##SIZE##_t src[10], dest[10];                                   \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, src, 10);                          \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, dest, 10);                         \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -255,9 +259,10 @@
   ({                                                                           \
     log_routine("shmem_getmem_nbi()");                                         \
     bool success = true;                                                       \
-    static char src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(char, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(char, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -309,9 +314,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_getmem_nbi()");                                     \
     bool success = true;                                                       \
-    static char src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(char, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(char, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -417,9 +423,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_get_nbi", result, false);
-  }
+  check_test_result("C shmem_get_nbi", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
@@ -438,9 +442,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_get<size>_nbi", result_size, false);
-  }
+  check_test_result("C shmem_get<size>_nbi", result_size, false);
 
   if (!result_size) {
     rc = EXIT_FAILURE;
@@ -451,9 +453,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_getmem_nbi", result_mem, false);
-  }
+  check_test_result("C shmem_getmem_nbi", result_mem, false);
 
   if (!result_mem) {
     rc = EXIT_FAILURE;
@@ -489,9 +489,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_get_nbi", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_get_nbi", result_ctx, false);
 
   if (!result_ctx) {
     rc = EXIT_FAILURE;
@@ -510,9 +508,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_get<size>_nbi", result_ctx_size, false);
-  }
+  check_test_result("C shmem_ctx_get<size>_nbi", result_ctx_size, false);
 
   if (!result_ctx_size) {
     rc = EXIT_FAILURE;
@@ -523,9 +519,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_getmem_nbi", result_ctx_mem, false);
-  }
+  check_test_result("C shmem_ctx_getmem_nbi", result_ctx_mem, false);
 
   if (!result_ctx_mem) {
     rc = EXIT_FAILURE;
@@ -14,9 +14,10 @@
   ({                                                                           \
     log_routine("shmem_" #TYPENAME "_iget()");                                 \
     bool success = true;                                                       \
-    static TYPE src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -67,9 +68,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_" #TYPENAME "_iget()");                             \
     bool success = true;                                                       \
-    static TYPE src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -136,9 +138,10 @@
   ({                                                                           \
     log_routine("shmem_iget" #SIZE "()");                                      \
     bool success = true;                                                       \
-    static uint##SIZE##_t src[10], dest[10];                                   \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, src, 10);                          \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, dest, 10);                         \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -190,9 +193,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_iget" #SIZE "()");                                  \
     bool success = true;                                                       \
-    static uint##SIZE##_t src[10], dest[10];                                   \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, src, 10);                          \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, dest, 10);                         \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -299,9 +303,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_iget", result, false);
-  }
+  check_test_result("C shmem_iget", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
@@ -320,9 +322,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_iget<size>", result_size, false);
-  }
+  check_test_result("C shmem_iget<size>", result_size, false);
 
   if (!result_size) {
     rc = EXIT_FAILURE;
@@ -358,9 +358,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_iget", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_iget", result_ctx, false);
 
   if (!result_ctx) {
     rc = EXIT_FAILURE;
@@ -379,9 +377,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_iget<size>", result_ctx_size, false);
-  }
+  check_test_result("C shmem_ctx_iget<size>", result_ctx_size, false);
 
   if (!result_ctx_size) {
     rc = EXIT_FAILURE;
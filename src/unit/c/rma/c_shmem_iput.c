@@ -14,9 +14,10 @@
   ({                                                                           \
     log_routine("shmem_" #TYPENAME "_iput()");                                 \
     bool success = true;                                                       \
-    static TYPE src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -66,9 +67,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_" #TYPENAME "_iput()");                             \
     bool success = true;                                                       \
-    static TYPE src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -134,9 +136,10 @@
   ({                                                                           \
     log_routine("shmem_iput" #SIZE "()");                                      \
     bool success = true;                                                       \
-    static uint##SIZE##_t src[10], dest[10];                                   \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, src, 10);                          \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, dest, 10);                         \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -188,9 +191,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_iput" #SIZE "()");                                  \
     bool success = true;                                                       \
-    static uint##SIZE##_t src[10], dest[10];                                   \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, src, 10);                          \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, dest, 10);                         \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -303,9 +307,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_iput", result, false);
-  }
+  check_test_result("C shmem_iput", result, false);
 
   /* Test SIZE-specific variants */
   int result_size = true;
@@ -320,9 +322,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_iput<size>", result_size, false);
-  }
+  check_test_result("C shmem_iput<size>", result_size, false);
 
   if (!result_size) {
     rc = EXIT_FAILURE;
@@ -362,9 +362,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_iput", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_iput", result_ctx, false);
 
   /* Test context SIZE-specific variants */
   int result_ctx_size = true;
@@ -379,9 +377,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_iput<size>", result_ctx_size, false);
-  }
+  check_test_result("C shmem_ctx_iput<size>", result_ctx_size, false);
 
   if (!result_ctx_size) {
     rc = EXIT_FAILURE;
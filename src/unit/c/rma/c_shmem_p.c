@@ -14,9 +14,10 @@
   ({                                                                           \
     log_routine("shmem_" #TYPENAME "_p()");                                    \
     bool success = true;                                                       \
-    static TYPE src, dest;                                                     \
-    log_info("Allocated static variables: src at %p, dest at %p",              \
-             (void *)&src, (void *)&dest);                                     \
+    static TYPE src;                                                           \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 1);                                    \
+    log_info("Allocated variables: src at %p, dest at %p",                     \
+             (void *)&src, (void *)dest);                                      \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -29,8 +30,8 @@
                                                                                \
     if (mype == 0) {                                                           \
       log_info("PE 0: Starting put operation to PE 1");                        \
-      log_info("PE 0: dest=%p, src=%d", (void *)&dest, src);                   \
-      shmem_##TYPENAME##_p(&dest, src, 1);                                     \
+      log_info("PE 0: dest=%p, src=%d", (void *)dest, src);                    \
+      shmem_##TYPENAME##_p(dest, src, 1);                                      \
       log_info("PE 0: Completed put operation");                               \
     }                                                                          \
                                                                                \
@@ -39,9 +40,9 @@
                                                                                \
     if (mype == 1) {                                                           \
       log_info("PE 1: Beginning validation of received data");                 \
-      if (dest != 0) {                                                         \
+      if (*dest != 0) {                                                        \
         log_fail("PE 1: Validation failed - dest = %d, expected 0",            \
-                 (int)dest);                                                   \
+                 (int)*dest);                                                  \
         success = false;                                                       \
       } else {                                                                 \
         log_info("PE 1: Validation successful - dest matches expected value"); \
@@ -57,9 +58,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_" #TYPENAME "_p()");                                \
     bool success = true;                                                       \
-    static TYPE src, dest;                                                     \
-    log_info("Allocated static variables: src at %p, dest at %p",              \
-             (void *)&src, (void *)&dest);                                     \
+    static TYPE src;                                                           \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 1);                                    \
+    log_info("Allocated variables: src at %p, dest at %p",                     \
+             (void *)&src, (void *)dest);                                      \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -82,8 +84,8 @@
                                                                                \
     if (mype == 0) {                                                           \
       log_info("PE 0: Starting context-based put operation to PE 1");          \
-      log_info("PE 0: dest=%p, src=%d", (void *)&dest, (int)src);              \
-      shmem_ctx_##TYPENAME##_p(ctx, &dest, src, 1);                            \
+      log_info("PE 0: dest=%p, src=%d", (void *)dest, (int)src);               \
+      shmem_ctx_##TYPENAME##_p(ctx, dest, src, 1);                             \
       log_info("PE 0: Completed context-based put operation");                 \
     }                                                                          \
                                                                                \
@@ -92,9 +94,9 @@
                                                                                \
     if (mype == 1) {                                                           \
       log_info("PE 1: Beginning validation of received data");                 \
-      if (dest != 20) { /* PE 0's value is 0+20=20 */                          \
+      if (*dest != 20) { /* PE 0's value is 0+20=20 */                         \
         log_fail("PE 1: Validation failed - dest = %d, expected 20",           \
-                 (int)dest);                                                   \
+                 (int)*dest);                                                  \
         success = false;                                                       \
       } else {                                                                 \
         log_info("PE 1: Validation successful - dest matches expected value"); \
@@ -159,9 +161,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_p", result, false);
-  }
+  check_test_result("C shmem_p", result, false);
 
   /* Test context-specific shmem_p variants */
   int result_ctx = true;
@@ -197,9 +197,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_p", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_p", result_ctx, false);
 
   log_close(rc);
   shmem_finalize();
@@ -14,9 +14,10 @@
   ({                                                                           \
     log_routine("shmem_" #TYPENAME "_put()");                                  \
     bool success = true;                                                       \
-    static TYPE src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -64,9 +65,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_" #TYPENAME "_put()");                              \
     bool success = true;                                                       \
-    static TYPE src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -130,9 +132,10 @@
   ({                                                                           \
     log_routine("shmem_put" #SIZE "()");                                       \
     bool success = true;                                                       \
-    static uint##SIZE##_t src[10], dest[10];                                   \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, src, 10);                          \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, dest, 10);                         \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -181,9 +184,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_put" #SIZE "()");                                   \
     bool success = true;                                                       \
-    static uint##SIZE##_t src[10], dest[10];                                   \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, src, 10);                          \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, dest, 10);                         \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -247,9 +251,10 @@
   ({                                                                           \
     log_routine("shmem_putmem()");                                             \
     bool success = true;                                                       \
-    static char src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(char, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(char, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -299,9 +304,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_putmem()");                                         \
     bool success = true;                                                       \
-    static char src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(char, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(char, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -403,9 +409,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_put", result, false);
-  }
+  check_test_result("C shmem_put", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
@@ -424,9 +428,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_put<size>", result_size, false);
-  }
+  check_test_result("C shmem_put<size>", result_size, false);
 
   if (!result_size) {
     rc = EXIT_FAILURE;
@@ -437,9 +439,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_putmem", result_mem, false);
-  }
+  check_test_result("C shmem_putmem", result_mem, false);
 
   if (!result_mem) {
     rc = EXIT_FAILURE;
@@ -479,9 +479,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_put", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_put", result_ctx, false);
 
   /* Test context SIZE-specific variants */
   int result_ctx_size = true;
@@ -496,9 +494,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_put<size>", result_ctx_size, false);
-  }
+  check_test_result("C shmem_ctx_put<size>", result_ctx_size, false);
 
   if (!result_ctx_size) {
     rc = EXIT_FAILURE;
@@ -509,9 +505,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_putmem", result_ctx_mem, false);
-  }
+  check_test_result("C shmem_ctx_putmem", result_ctx_mem, false);
 
   if (!result_ctx_mem) {
     rc = EXIT_FAILURE;
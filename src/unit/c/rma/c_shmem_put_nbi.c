@@ -14,9 +14,10 @@
   ({                                                                           \
     log_routine("shmem_" #TYPENAME "_put_nbi()");                              \
     bool success = true;                                                       \
-    static TYPE src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -65,9 +66,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_" #TYPENAME "_put_nbi()");                          \
     bool success = true;                                                       \
-    static TYPE src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -132,9 +134,10 @@
   ({                                                                           \
     log_routine("shmem_put" #SIZE "_nbi()");                                   \
     bool success = true;                                                       \
-    static uint##SIZE##_t src[10], dest[10];                                   \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, src, 10);                          \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, dest, 10);                         \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -184,9 +187,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_put" #SIZE "_nbi()");                               \
     bool success = true;                                                       \
-    static uint##SIZE##_t src[10], dest[10];                                   \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, src, 10);                          \
+    SHMEMVV_SYMMETRIC_ARRAY(uint##SIZE##_t, dest, 10);                         \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -251,9 +255,10 @@
   ({                                                                           \
     log_routine("shmem_putmem_nbi()");                                         \
     bool success = true;                                                       \
-    static char src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(char, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(char, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -304,9 +309,10 @@
   ({                                                                           \
     log_routine("shmem_ctx_putmem_nbi()");                                     \
     bool success = true;                                                       \
-    static char src[10], dest[10];                                             \
-    log_info("Allocated static arrays: src at %p, dest at %p", (void *)&src,   \
-             (void *)&dest);                                                   \
+    SHMEMVV_SYMMETRIC_ARRAY(char, src, 10);                                    \
+    SHMEMVV_SYMMETRIC_ARRAY(char, dest, 10);                                   \
+    log_info("Allocated symmetric arrays: src at %p, dest at %p", (void *)src, \
+             (void *)dest);                                                    \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -413,9 +419,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_put_nbi", result, false);
-  }
+  check_test_result("C shmem_put_nbi", result, false);
 
   /* Test SIZE-specific variants */
   int result_size = true;
@@ -430,9 +434,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_put<size>_nbi", result_size, false);
-  }
+  check_test_result("C shmem_put<size>_nbi", result_size, false);
 
   if (!result_size) {
     rc = EXIT_FAILURE;
@@ -443,9 +445,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_putmem_nbi", result_mem, false);
-  }
+  check_test_result("C shmem_putmem_nbi", result_mem, false);
 
   if (!result_mem) {
     rc = EXIT_FAILURE;
@@ -485,9 +485,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_put_nbi", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_put_nbi", result_ctx, false);
 
   /* Test context SIZE-specific variants */
   int result_ctx_size = true;
@@ -502,9 +500,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_put<size>_nbi", result_ctx_size, false);
-  }
+  check_test_result("C shmem_ctx_put<size>_nbi", result_ctx_size, false);
 
   if (!result_ctx_size) {
     rc = EXIT_FAILURE;
@@ -515,9 +511,7 @@ int main(int argc, char *argv[]) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_ctx_putmem_nbi", result_ctx_mem, false);
-  }
+  check_test_result("C shmem_ctx_putmem_nbi", result_ctx_mem, false);
 
   if (!result_ctx_mem) {
     rc = EXIT_FAILURE;
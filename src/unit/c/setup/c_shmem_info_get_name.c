@@ -47,9 +47,7 @@ int main(int argc, char *argv[]) {
     free(name);
   }
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_info_get_name", result, false);
-  }
+  check_test_result("C shmem_info_get_name", result, false);
 
   log_close(rc);
   shmem_finalize();
@@ -47,9 +47,7 @@ int main(int argc, char *argv[]) {
     log_info("shmem_info_get_version() test completed successfully");
   }
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_info_get_version", result, false);
-  }
+  check_test_result("C shmem_info_get_version", result, false);
 
   log_close(rc);
   shmem_finalize();
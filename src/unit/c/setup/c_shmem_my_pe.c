@@ -45,9 +45,7 @@ int main(int argc, char *argv[]) {
     log_info("shmem_my_pe() test completed successfully");
   }
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_my_pe", result, false);
-  }
+  check_test_result("C shmem_my_pe", result, false);
 
   log_close(rc);
   shmem_finalize();
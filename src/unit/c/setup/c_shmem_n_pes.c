@@ -41,9 +41,7 @@ int main(int argc, char *argv[]) {
     log_info("shmem_n_pes() test completed successfully");
   }
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C shmem_n_pes", result, false);
-  }
+  check_test_result("C shmem_n_pes", result, false);
 
   log_close(rc);
   shmem_finalize();
@@ -406,9 +406,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C shmem_put_signal", result, false);
-  }
+  check_test_result("C shmem_put_signal", result, false);
 
   /* Test SIZE-specific variants */
   int result_size = true;
@@ -425,9 +423,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C shmem_put<size>_signal", result_size, false);
-  }
+  check_test_result("C shmem_put<size>_signal", result_size, false);
 
   /* Test memory-specific variant */
   int result_mem = TEST_C_SHMEM_PUTMEM_SIGNAL();
@@ -436,9 +432,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C shmem_putmem_signal", result_mem, false);
-  }
+  check_test_result("C shmem_putmem_signal", result_mem, false);
 
   /* Test context-specific SIZE variants */
   int result_ctx_size = true;
@@ -455,9 +449,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C shmem_ctx_put<size>_signal", result_ctx_size, false);
-  }
+  check_test_result("C shmem_ctx_put<size>_signal", result_ctx_size, false);
 
   /* Test context-specific memory variant */
   int result_ctx_mem = TEST_C_CTX_SHMEM_PUTMEM_SIGNAL();
@@ -466,9 +458,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C shmem_ctx_putmem_signal", result_ctx_mem, false);
-  }
+  check_test_result("C shmem_ctx_putmem_signal", result_ctx_mem, false);
 
   log_close(rc);
   shmem_finalize();
@@ -476,9 +476,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C shmem_put_signal_nbi", result, false);
-  }
+  check_test_result("C shmem_put_signal_nbi", result, false);
 
   /* Test SIZE-specific variants */
   int result_size = true;
@@ -495,9 +493,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C shmem_put<size>_signal_nbi", result_size, false);
-  }
+  check_test_result("C shmem_put<size>_signal_nbi", result_size, false);
 
   /* Test memory-specific variant */
   int result_mem = TEST_C_SHMEM_PUTMEM_SIGNAL_NBI();
@@ -506,9 +502,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C shmem_putmem_signal_nbi", result_mem, false);
-  }
+  check_test_result("C shmem_putmem_signal_nbi", result_mem, false);
 
   /* Test context TYPENAME variants */
   int result_ctx = true;
@@ -541,9 +535,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C shmem_ctx_put_signal_nbi", result_ctx, false);
-  }
+  check_test_result("C shmem_ctx_put_signal_nbi", result_ctx, false);
 
   /* Test context SIZE-specific variants */
   int result_ctx_size = true;
@@ -560,10 +552,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C shmem_ctx_put<size>_signal_nbi", result_ctx_size,
-                        false);
-  }
+  check_test_result("C shmem_ctx_put<size>_signal_nbi", result_ctx_size, false);
 
   /* Test context memory-specific variant */
   int result_ctx_mem = TEST_C_CTX_SHMEM_PUTMEM_SIGNAL_NBI();
@@ -572,9 +561,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C shmem_ctx_putmem_signal_nbi", result_ctx_mem, false);
-  }
+  check_test_result("C shmem_ctx_putmem_signal_nbi", result_ctx_mem, false);
 
   log_close(rc);
   shmem_finalize();
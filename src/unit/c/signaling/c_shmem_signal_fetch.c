@@ -14,8 +14,9 @@
   ({                                                                           \
     log_routine("shmem_signal_fetch()");                                       \
     bool success = true;                                                       \
-    static uint64_t signal = 1;                                                \
-    log_info("signal initialized to %lu @ %p", signal, &signal);               \
+    SHMEMVV_SYMMETRIC_ARRAY(uint64_t, signal, 1);                              \
+    *signal = 1;                                                               \
+    log_info("signal initialized to %lu @ %p", *signal, (void *)signal);       \
     uint64_t fetched_signal = 0;                                               \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
@@ -29,8 +30,8 @@
                                                                                \
       if (mype == 1) {                                                         \
         log_info("PE %d calling shmem_signal_fetch(signal = %p)", mype,        \
-                 &signal);                                                     \
-        fetched_signal = shmem_signal_fetch(&signal);                          \
+                 (void *)signal);                                              \
+        fetched_signal = shmem_signal_fetch(signal);                           \
         log_info("fetched signal value: %lu", fetched_signal);                 \
         if (fetched_signal != 1) {                                             \
           log_fail("unexpected return value: expected 1, found %lu",           \
@@ -70,9 +71,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C shmem_signal_fetch", result, false);
-  }
+  check_test_result("C shmem_signal_fetch", result, false);
 
   log_close(rc);
   shmem_finalize();
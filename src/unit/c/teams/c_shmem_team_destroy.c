@@ -68,9 +68,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C shmem_team_destroy", result, false);
-  }
+  check_test_result("C shmem_team_destroy", result, false);
 
   log_info("Test completed with %s", result ? "SUCCESS" : "FAILURE");
   log_close(rc);
@@ -73,9 +73,7 @@ int main(int argc, char *argv[]) {
   bool result = test_shmem_team_get_config();
   int rc = result ? EXIT_SUCCESS : EXIT_FAILURE;
 
-  if (mype == 0) {
-    display_test_result("C shmem_team_get_config", result, false);
-  }
+  check_test_result("C shmem_team_get_config", result, false);
 
   log_close(rc);
   shmem_finalize();
@@ -81,9 +81,7 @@ int main(int argc, char *argv[]) {
   bool result = test_shmem_team_translate_pe();
   int rc = result ? EXIT_SUCCESS : EXIT_FAILURE;
 
-  if (mype == 0) {
-    display_test_result("C shmem_team_translate_pe", result, false);
-  }
+  check_test_result("C shmem_team_translate_pe", result, false);
 
   log_info("Test completed with %s", result ? "SUCCESS" : "FAILURE");
   log_close(rc);
@@ -39,9 +39,7 @@ int main(int argc, char *argv[]) {
   bool result = test_shmem_query_thread();
   int rc = result ? EXIT_SUCCESS : EXIT_FAILURE;
 
-  if (mype == 0) {
-    display_test_result("C shmem_query_thread", result, false);
-  }
+  check_test_result("C shmem_query_thread", result, false);
 
   log_close(rc);
   shmem_finalize();
@@ -102,9 +102,7 @@ int main(int argc, char **argv) {
 
   shmem_barrier_all();
 
-  if (shmem_my_pe() == 0) {
-    display_test_result("C11 shmem_wait_until_some", result, false);
-  }
+  check_test_result("C11 shmem_wait_until_some", result, false);
 
   if (!result) {
     rc = EXIT_FAILURE;
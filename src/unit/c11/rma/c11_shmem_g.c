@@ -15,16 +15,17 @@
   ({                                                                           \
     log_routine("shmem_g(" #TYPE ")");                                         \
     bool success = true;                                                       \
-    static TYPE src, dest;                                                     \
-    log_info("Allocated static variables: src at %p, dest at %p",              \
-             (void *)&src, (void *)&dest);                                     \
+    static TYPE dest;                                                          \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 1);                                     \
+    log_info("Allocated variables: src at %p, dest at %p",                     \
+             (void *)src, (void *)&dest);                                      \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
                                                                                \
     if (mype == 0) {                                                           \
-      src = 10;                                                                \
-      log_info("PE 0: Initialized src = %d", (int)src);                        \
+      *src = 10;                                                               \
+      log_info("PE 0: Initialized src = %d", (int)*src);                       \
     }                                                                          \
                                                                                \
     shmem_barrier_all();                                                       \
@@ -32,7 +33,7 @@
                                                                                \
     if (mype == 1) {                                                           \
       log_info("PE 1: Fetching remote value from PE 0");                       \
-      dest = shmem_g(&src, 0);                                                 \
+      dest = shmem_g(src, 0);                                                  \
       log_info("PE 1: Fetched value dest = %d", (int)dest);                    \
                                                                                \
       log_info("PE 1: Beginning validation");                                  \
@@ -54,9 +55,10 @@
   ({                                                                           \
     log_routine("shmem_g(ctx, " #TYPE ")");                                    \
     bool success = true;                                                       \
-    static TYPE src, dest;                                                     \
-    log_info("Allocated static variables: src at %p, dest at %p",              \
-             (void *)&src, (void *)&dest);                                     \
+    static TYPE dest;                                                          \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, src, 1);                                     \
+    log_info("Allocated variables: src at %p, dest at %p",                     \
+             (void *)src, (void *)&dest);                                      \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -72,8 +74,8 @@
     log_info("Successfully created context");                                  \
                                                                                \
     if (mype == 0) {                                                           \
-      src = 20;                                                                \
-      log_info("PE 0: Initialized src = %d", (int)src);                        \
+      *src = 20;                                                               \
+      log_info("PE 0: Initialized src = %d", (int)*src);                       \
     }                                                                          \
                                                                                \
     shmem_barrier_all();                                                       \
@@ -81,7 +83,7 @@
                                                                                \
     if (mype == 1) {                                                           \
       log_info("PE 1: Fetching remote value from PE 0 using context");         \
-      dest = shmem_g(ctx, &src, 0);                                            \
+      dest = shmem_g(ctx, src, 0);                                             \
       log_info("PE 1: Fetched value dest = %d", (int)dest);                    \
                                                                                \
       log_info("PE 1: Beginning validation");                                  \
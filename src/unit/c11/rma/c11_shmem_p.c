@@ -15,9 +15,11 @@
   ({                                                                           \
     log_routine("shmem_p(" #TYPE ")");                                         \
     bool success = true;                                                       \
-    static TYPE src = -1, dest = -1;                                           \
-    log_info("Allocated static variables: src at %p, dest at %p",              \
-             (void *)&src, (void *)&dest);                                     \
+    static TYPE src = -1;                                                      \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 1);                                    \
+    *dest = -1;                                                                \
+    log_info("Allocated variables: src at %p, dest at %p",                     \
+             (void *)&src, (void *)dest);                                      \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -30,8 +32,8 @@
                                                                                \
     if (mype == 0) {                                                           \
       log_info("PE 0: Starting put operation to PE 1");                        \
-      log_info("PE 0: dest=%p, src=%d", (void *)&dest, src);                   \
-      shmem_p(&dest, src, 1);                                                  \
+      log_info("PE 0: dest=%p, src=%d", (void *)dest, src);                    \
+      shmem_p(dest, src, 1);                                                   \
       log_info("PE 0: Completed put operation");                               \
     }                                                                          \
                                                                                \
@@ -40,9 +42,9 @@
                                                                                \
     if (mype == 1) {                                                           \
       log_info("PE 1: Beginning validation of received data");                 \
-      if (dest != 0) {                                                         \
+      if (*dest != 0) {                                                        \
         log_fail("PE 1: Validation failed - dest = %d, expected 0",            \
-                 (int)dest);                                                   \
+                 (int)*dest);                                                  \
         success = false;                                                       \
       } else {                                                                 \
         log_info("PE 1: Validation successful - dest matches expected value"); \
@@ -58,9 +60,11 @@
   ({                                                                           \
     log_routine("shmem_p(ctx, " #TYPE ")");                                    \
     bool success = true;                                                       \
-    static TYPE src = -1, dest = -1;                                           \
-    log_info("Allocated static variables: src at %p, dest at %p",              \
-             (void *)&src, (void *)&dest);                                     \
+    static TYPE src = -1;                                                      \
+    SHMEMVV_SYMMETRIC_ARRAY(TYPE, dest, 1);                                    \
+    *dest = -1;                                                                \
+    log_info("Allocated variables: src at %p, dest at %p",                     \
+             (void *)&src, (void *)dest);                                      \
     int mype = shmem_my_pe();                                                  \
     int npes = shmem_n_pes();                                                  \
     log_info("Running on PE %d of %d total PEs", mype, npes);                  \
@@ -83,8 +87,8 @@
                                                                                \
     if (mype == 0) {                                                           \
       log_info("PE 0: Starting context-based put operation to PE 1");          \
-      log_info("PE 0: dest=%p, src=%d", (void *)&dest, (int)src);              \
-      shmem_p(ctx, &dest, src, 1);                                             \
+      log_info("PE 0: dest=%p, src=%d", (void *)dest, (int)src);               \
+      shmem_p(ctx, dest, src, 1);                                              \
       log_info("PE 0: Completed context-based put operation");                 \
     }                                                                          \
                                                                                \
@@ -94,9 +98,9 @@
                                                                                \
     if (mype == 1) {                                                           \
       log_info("PE 1: Beginning validation of received data");                 \
-      if (dest != 20) { /* PE 0's value is 0+20=20 */                          \
+      if (*dest != 20) { /* PE 0's value is 0+20=20 */                         \
         log_fail("PE 1: Validation failed - dest = %d, expected 20",           \
-                 (int)dest);                                                   \
+                 (int)*dest);                                                  \
         success = false;                                                       \
       } else {                                                                 \
         log_info("PE 1: Validation successful - dest matches expected value"); \
@@ -198,9 +198,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C11 shmem_put_signal", result, false);
-  }
+  check_test_result("C11 shmem_put_signal", result, false);
 
   /* Test context-specific variants in C11 */
   int result_ctx = true;
@@ -234,9 +232,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C11 shmem_put_signal with ctx", result_ctx, false);
-  }
+  check_test_result("C11 shmem_put_signal with ctx", result_ctx, false);
 
   log_close(rc);
   shmem_finalize();
@@ -192,9 +192,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C11 shmem_put_signal_nbi", result, false);
-  }
+  check_test_result("C11 shmem_put_signal_nbi", result, false);
 
   /* Test context-specific variants */
   int result_ctx = true;
@@ -227,9 +225,7 @@ int main(int argc, char *argv[]) {
     rc = EXIT_FAILURE;
   }
 
-  if (mype == 0) {
-    display_test_result("C11 shmem_put_signal_nbi with ctx", result_ctx, false);
-  }
+  check_test_result("C11 shmem_put_signal_nbi with ctx", result_ctx, false);
 
   log_close(rc);
   shmem_finalize();